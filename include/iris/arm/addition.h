@@ -1,44 +1,71 @@
 
 #include "common.h"
+#include "sse/addition.h"
+#include "gnu/addition.h"
 #ifndef IRIS_ARM_ADDITION
 #define IRIS_ARM_ADDITION
 namespace iris::arm::addition
 {
 
-template <typename T>
-T __vadd(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vadd(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vadd(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vadd(v1, v2);
+    }
+#endif
     return v1.add(v2);
 }
 
-const auto &vadd_u8 = __vadd<uint8x8_t>;
-const auto &vadd_u16 = __vadd<uint16x4_t>;
-const auto &vadd_u32 = __vadd<uint32x2_t>;
-const auto &vadd_u64 = __vadd<uint64x1_t>;
+constexpr auto vadd_u8 = __vadd<uint8x8_t>;
+constexpr auto vadd_u16 = __vadd<uint16x4_t>;
+constexpr auto vadd_u32 = __vadd<uint32x2_t>;
+constexpr auto vadd_u64 = __vadd<uint64x1_t>;
 
-const auto &vadd_s8 = __vadd<int8x8_t>;
-const auto &vadd_s16 = __vadd<int16x4_t>;
-const auto &vadd_s32 = __vadd<int32x2_t>;
-const auto &vadd_s64 = __vadd<int64x1_t>;
+constexpr auto vadd_s8 = __vadd<int8x8_t>;
+constexpr auto vadd_s16 = __vadd<int16x4_t>;
+constexpr auto vadd_s32 = __vadd<int32x2_t>;
+constexpr auto vadd_s64 = __vadd<int64x1_t>;
 
-const auto &vadd_f32 = __vadd<float32x2_t>;
+constexpr auto vadd_f32 = __vadd<float32x2_t>;
 
-const auto &vaddq_u8 = __vadd<uint8x16_t>;
-const auto &vaddq_u16 = __vadd<uint16x8_t>;
-const auto &vaddq_u32 = __vadd<uint32x4_t>;
-const auto &vaddq_u64 = __vadd<uint64x2_t>;
+constexpr auto vaddq_u8 = __vadd<uint8x16_t>;
+constexpr auto vaddq_u16 = __vadd<uint16x8_t>;
+constexpr auto vaddq_u32 = __vadd<uint32x4_t>;
+constexpr auto vaddq_u64 = __vadd<uint64x2_t>;
 
-const auto &vaddq_s8 = __vadd<int8x16_t>;
-const auto &vaddq_s16 = __vadd<int16x8_t>;
-const auto &vaddq_s32 = __vadd<int32x4_t>;
-const auto &vaddq_s64 = __vadd<int64x2_t>;
+constexpr auto vaddq_s8 = __vadd<int8x16_t>;
+constexpr auto vaddq_s16 = __vadd<int16x8_t>;
+constexpr auto vaddq_s32 = __vadd<int32x4_t>;
+constexpr auto vaddq_s64 = __vadd<int64x2_t>;
 
-const auto &vaddq_f32 = __vadd<float32x4_t>;
+constexpr auto vaddq_f32 = __vadd<float32x4_t>;
 
 template <typename T,
-          typename R>
-R __vaddl(T v1, T v2)
+          typename R,
+          typename B = backend::best>
+IRIS_INLINE constexpr R __vaddl(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vaddl<T, R, B>(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vaddl<T, R>(v1, v2);
+    }
+#endif
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
@@ -49,17 +76,29 @@ R __vaddl(T v1, T v2)
     return result;
 }
 
-const auto &vaddl_s8 = __vaddl<int8x8_t, int16x8_t>;
-const auto &vaddl_s16 = __vaddl<int16x4_t, int32x4_t>;
-const auto &vaddl_s32 = __vaddl<int32x2_t, int64x2_t>;
+constexpr auto vaddl_s8 = __vaddl<int8x8_t, int16x8_t>;
+constexpr auto vaddl_s16 = __vaddl<int16x4_t, int32x4_t>;
+constexpr auto vaddl_s32 = __vaddl<int32x2_t, int64x2_t>;
 
-const auto &vaddl_u8 = __vaddl<uint8x8_t, uint16x8_t>;
-const auto &vaddl_u16 = __vaddl<uint16x4_t, uint32x4_t>;
-const auto &vaddl_u32 = __vaddl<uint32x2_t, uint64x2_t>;
+constexpr auto vaddl_u8 = __vaddl<uint8x8_t, uint16x8_t>;
+constexpr auto vaddl_u16 = __vaddl<uint16x4_t, uint32x4_t>;
+constexpr auto vaddl_u32 = __vaddl<uint32x2_t, uint64x2_t>;
 
-template <typename R, typename T>
-R __vaddw(R v1, T v2)
+template <typename R, typename T, typename B = backend::best>
+IRIS_INLINE constexpr R __vaddw(R v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vaddw<R, T, B>(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vaddw<R, T>(v1, v2);
+    }
+#endif
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
@@ -69,191 +108,333 @@ R __vaddw(R v1, T v2)
     return result;
 }
 
-template <typename T>
-T __vhadd(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vhadd(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vhadd(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(i) + v2.template at<typename T::elementType>(i);
-        result.template at<typename T::elementType>(i) /= 2;
+        int64_t x = v1.template at<typename T::elementType>(i);
+        int64_t y = v2.template at<typename T::elementType>(i);
+        result.template at<typename T::elementType>(i) = static_cast<typename T::elementType>((x + y) >> 1);
     }
     return result;
 }
 
-template <typename T>
-T __vrhadd(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vrhadd(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vrhadd(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        typename T::elementType x = (v1.template at<typename T::elementType>(i) + v2.template at<typename T::elementType>(i));
-        if ((x >> 1) * 2 == x)
-        {
-            x = x >> 1;
-        }
-        else
-        {
-            x = (x >> 1) + 1;
-        }
-        result.template at<typename T::elementType>(i) = x;
+        int64_t x = v1.template at<typename T::elementType>(i);
+        int64_t y = v2.template at<typename T::elementType>(i);
+        result.template at<typename T::elementType>(i) = static_cast<typename T::elementType>((x + y + 1) >> 1);
     }
     return result;
 }
 
-template <typename T>
-T __vqadd(T v1, T v2)
+// Saturating x + y on the wrapped unsigned sum. A signed sum overflows when
+// it differs in sign from both operands, and then saturates towards the sign
+// of x; an unsigned sum overflows when it wraps below x.
+template <typename E>
+IRIS_INLINE constexpr E __iris__qadd(E x, E y)
+{
+    using U = typename std::make_unsigned<E>::type;
+    U s = static_cast<U>(U(x) + U(y));
+    if constexpr (std::is_signed<E>::value)
+    {
+        constexpr uint32_t top = sizeof(E) * 8 - 1;
+        U m = static_cast<U>(U(0) - U(((U(x) ^ s) & (U(y) ^ s)) >> top));
+        U saturated = static_cast<U>(U(U(x) >> top) + U(std::numeric_limits<E>::max()));
+        return static_cast<E>(static_cast<U>((s & ~m) | (saturated & m)));
+    }
+    else
+    {
+        return static_cast<E>(static_cast<U>(s | (U(0) - U(s < x))));
+    }
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vqadd(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqadd(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
         auto x = v1.template at<typename T::elementType>(i);
         auto y = v2.template at<typename T::elementType>(i);
-        if ((y > 0) && (x > std::numeric_limits<typename T::elementType>::max() - y))
-        {
-            result.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
-        }
-        else if ((x < 0) && (y < std::numeric_limits<typename T::elementType>::max() - y))
-        {
-            result.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::min();
-        }
-        else
-        {
-            result.template at<typename T::elementType>(i) = x + y;
-        }
+        result.template at<typename T::elementType>(i) = __iris__qadd(x, y);
     }
     return result;
 }
 
-template <typename T, typename R>
-R __vaddhn(T v1, T v2)
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vaddhn(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vaddhn<T, R>(v1, v2);
+    }
+#endif
+    using U = typename std::make_unsigned<typename T::elementType>::type;
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
-        auto x = v1.template at<typename T::elementType>(i);
-        auto y = v2.template at<typename T::elementType>(i);
-        auto temp = x + y;
-        auto part = reinterpret_cast<typename R::elementType *>(&temp)[1];
-        result.template at<typename R::elementType>(i) = part;
+        U x = v1.template at<typename T::elementType>(i);
+        U y = v2.template at<typename T::elementType>(i);
+        U sum = x + y;
+        result.template at<typename R::elementType>(i) = static_cast<typename R::elementType>(sum >> (sizeof(U) * 4));
     }
     return result;
 }
 
-template <typename T, typename R>
-R __vraddhn(T v1, T v2)
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vraddhn(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vraddhn<T, R>(v1, v2);
+    }
+#endif
+    using U = typename std::make_unsigned<typename T::elementType>::type;
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
-        auto x = v1.template at<typename T::elementType>(i);
-        auto y = v2.template at<typename T::elementType>(i);
-        typename T::elementType sum = 0;
-        if ((x > 0) && (y > std::numeric_limits<typename T::elementType>::max() - x))
-        {
-            sum = std::numeric_limits<typename T::elementType>::max();
-        }
-        else if ((x < 0) && (y < std::numeric_limits<typename T::elementType>::min() - x))
-        {
-            sum = std::numeric_limits<typename T::elementType>::min();
-        }
-        else
-        {
-            sum = x + y;
-        }
-        auto part = reinterpret_cast<typename R::elementType *>(&sum)[1];
-        result.template at<typename R::elementType>(i) = part;
+        U x = v1.template at<typename T::elementType>(i);
+        U y = v2.template at<typename T::elementType>(i);
+        U sum = x + y + (U(1) << (sizeof(U) * 4 - 1));
+        result.template at<typename R::elementType>(i) = static_cast<typename R::elementType>(sum >> (sizeof(U) * 4));
     }
     return result;
 }
 
-const auto &vaddw_u8 = __vaddw<uint16x8_t, uint8x8_t>;
-const auto &vaddw_u16 = __vaddw<uint32x4_t, uint16x4_t>;
-const auto &vaddw_u32 = __vaddw<uint64x2_t, uint32x2_t>;
+constexpr auto vaddw_u8 = __vaddw<uint16x8_t, uint8x8_t>;
+constexpr auto vaddw_u16 = __vaddw<uint32x4_t, uint16x4_t>;
+constexpr auto vaddw_u32 = __vaddw<uint64x2_t, uint32x2_t>;
 
-const auto &vaddw_s8 = __vaddw<int16x8_t, int8x8_t>;
-const auto &vaddw_s16 = __vaddw<int32x4_t, int16x4_t>;
-const auto &vaddw_s32 = __vaddw<int64x2_t, int32x2_t>;
+constexpr auto vaddw_s8 = __vaddw<int16x8_t, int8x8_t>;
+constexpr auto vaddw_s16 = __vaddw<int32x4_t, int16x4_t>;
+constexpr auto vaddw_s32 = __vaddw<int64x2_t, int32x2_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vaddhn ///////////////////////////////////////////////////////
-const auto &vaddhn_s16 = __vaddhn<int16x8_t, int8x8_t>;
-const auto &vaddhn_s32 = __vaddhn<int32x4_t, int16x4_t>;
-const auto &vaddhn_s64 = __vaddhn<int64x2_t, int32x2_t>;
+constexpr auto vaddhn_s16 = __vaddhn<int16x8_t, int8x8_t>;
+constexpr auto vaddhn_s32 = __vaddhn<int32x4_t, int16x4_t>;
+constexpr auto vaddhn_s64 = __vaddhn<int64x2_t, int32x2_t>;
+
+constexpr auto vaddhn_u16 = __vaddhn<uint16x8_t, uint8x8_t>;
+constexpr auto vaddhn_u32 = __vaddhn<uint32x4_t, uint16x4_t>;
+constexpr auto vaddhn_u64 = __vaddhn<uint64x2_t, uint32x2_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vhadd - 64-bit vectors ///////////////////////////////////////////////////////
-const auto &vhadd_u8 = __vhadd<uint8x8_t>;
-const auto &vhadd_u16 = __vhadd<uint16x4_t>;
-const auto &vhadd_u32 = __vhadd<uint32x2_t>;
+constexpr auto vhadd_u8 = __vhadd<uint8x8_t>;
+constexpr auto vhadd_u16 = __vhadd<uint16x4_t>;
+constexpr auto vhadd_u32 = __vhadd<uint32x2_t>;
 
-const auto &vhadd_s8 = __vhadd<int16x8_t>;
-const auto &vhadd_s16 = __vhadd<int32x4_t>;
-const auto &vhadd_s32 = __vhadd<int64x2_t>;
+constexpr auto vhadd_s8 = __vhadd<int8x8_t>;
+constexpr auto vhadd_s16 = __vhadd<int16x4_t>;
+constexpr auto vhadd_s32 = __vhadd<int32x2_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vhadd - 128-bit vectors ///////////////////////////////////////////////////////
-const auto &vhaddq_u8 = __vhadd<uint8x16_t>;
-const auto &vhaddq_u16 = __vhadd<uint16x8_t>;
-const auto &vhaddq_u32 = __vhadd<uint32x4_t>;
+constexpr auto vhaddq_u8 = __vhadd<uint8x16_t>;
+constexpr auto vhaddq_u16 = __vhadd<uint16x8_t>;
+constexpr auto vhaddq_u32 = __vhadd<uint32x4_t>;
 
-const auto &vhaddq_s8 = __vhadd<int8x16_t>;
-const auto &vhaddq_s16 = __vhadd<int16x8_t>;
-const auto &vhaddq_s32 = __vhadd<int32x4_t>;
+constexpr auto vhaddq_s8 = __vhadd<int8x16_t>;
+constexpr auto vhaddq_s16 = __vhadd<int16x8_t>;
+constexpr auto vhaddq_s32 = __vhadd<int32x4_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vrhadd - 64-bit vectors ///////////////////////////////////////////////////////
-const auto &vrhadd_u8 = __vrhadd<uint8x8_t>;
-const auto &vrhadd_u16 = __vrhadd<uint16x4_t>;
-const auto &vrhadd_u32 = __vrhadd<uint32x2_t>;
+constexpr auto vrhadd_u8 = __vrhadd<uint8x8_t>;
+constexpr auto vrhadd_u16 = __vrhadd<uint16x4_t>;
+constexpr auto vrhadd_u32 = __vrhadd<uint32x2_t>;
 
-const auto &vrhadd_s8 = __vrhadd<int16x8_t>;
-const auto &vrhadd_s16 = __vrhadd<int32x4_t>;
-const auto &vrhadd_s32 = __vrhadd<int64x2_t>;
+constexpr auto vrhadd_s8 = __vrhadd<int8x8_t>;
+constexpr auto vrhadd_s16 = __vrhadd<int16x4_t>;
+constexpr auto vrhadd_s32 = __vrhadd<int32x2_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vrhadd - 128-bit vectors ///////////////////////////////////////////////////////
-const auto &vrhaddq_u8 = __vrhadd<uint8x16_t>;
-const auto &vrhaddq_u16 = __vrhadd<uint16x8_t>;
-const auto &vrhaddq_u32 = __vrhadd<uint32x4_t>;
+constexpr auto vrhaddq_u8 = __vrhadd<uint8x16_t>;
+constexpr auto vrhaddq_u16 = __vrhadd<uint16x8_t>;
+constexpr auto vrhaddq_u32 = __vrhadd<uint32x4_t>;
 
-const auto &vrhaddq_s8 = __vrhadd<int8x16_t>;
-const auto &vrhaddq_s16 = __vrhadd<int16x8_t>;
-const auto &vrhaddq_s32 = __vrhadd<int32x4_t>;
+constexpr auto vrhaddq_s8 = __vrhadd<int8x16_t>;
+constexpr auto vrhaddq_s16 = __vrhadd<int16x8_t>;
+constexpr auto vrhaddq_s32 = __vrhadd<int32x4_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vraddhn - 128-bit vectors ///////////////////////////////////////////////////////
-const auto &vraddhn_u16 = __vraddhn<uint16x8_t, uint8x8_t>;
-const auto &vraddhn_u32 = __vraddhn<uint32x4_t, uint16x4_t>;
-const auto &vraddhn_u64 = __vraddhn<uint64x2_t, uint32x2_t>;
+constexpr auto vraddhn_u16 = __vraddhn<uint16x8_t, uint8x8_t>;
+constexpr auto vraddhn_u32 = __vraddhn<uint32x4_t, uint16x4_t>;
+constexpr auto vraddhn_u64 = __vraddhn<uint64x2_t, uint32x2_t>;
 
-const auto &vraddhn_s16 = __vraddhn<int16x8_t, int8x8_t>;
-const auto &vraddhn_s32 = __vraddhn<int32x4_t, int16x4_t>;
-const auto &vraddhn_s64 = __vraddhn<int64x2_t, int32x2_t>;
+constexpr auto vraddhn_s16 = __vraddhn<int16x8_t, int8x8_t>;
+constexpr auto vraddhn_s32 = __vraddhn<int32x4_t, int16x4_t>;
+constexpr auto vraddhn_s64 = __vraddhn<int64x2_t, int32x2_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vqadd - 64-bit vectors ///////////////////////////////////////////////////////
-const auto &vqadd_u8 = __vqadd<uint8x8_t>;
-const auto &vqadd_u16 = __vqadd<uint16x4_t>;
-const auto &vqadd_u32 = __vqadd<uint32x2_t>;
-const auto &vqadd_u64 = __vqadd<uint64x1_t>;
-
-const auto &vqadd_s8 = __vqadd<int8x8_t>;
-const auto &vqadd_s16 = __vqadd<int16x4_t>;
-const auto &vqadd_s32 = __vqadd<int32x2_t>;
-const auto &vqadd_s64 = __vqadd<int64x1_t>;
+constexpr auto vqadd_u8 = __vqadd<uint8x8_t>;
+constexpr auto vqadd_u16 = __vqadd<uint16x4_t>;
+constexpr auto vqadd_u32 = __vqadd<uint32x2_t>;
+constexpr auto vqadd_u64 = __vqadd<uint64x1_t>;
+
+constexpr auto vqadd_s8 = __vqadd<int8x8_t>;
+constexpr auto vqadd_s16 = __vqadd<int16x4_t>;
+constexpr auto vqadd_s32 = __vqadd<int32x2_t>;
+constexpr auto vqadd_s64 = __vqadd<int64x1_t>;
 ///////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vqadd - 128-bit vectors ///////////////////////////////////////////////////////
-const auto &vqaddq_u8 = __vqadd<uint8x16_t>;
-const auto &vqaddq_u16 = __vqadd<uint16x8_t>;
-const auto &vqaddq_u32 = __vqadd<uint32x4_t>;
-const auto &vqaddq_u64 = __vqadd<uint64x2_t>;
-
-const auto &vqaddq_s8 = __vqadd<int8x16_t>;
-const auto &vqaddq_s16 = __vqadd<int16x8_t>;
-const auto &vqaddq_s32 = __vqadd<int32x4_t>;
-const auto &vqaddq_s64 = __vqadd<int64x2_t>;
+constexpr auto vqaddq_u8 = __vqadd<uint8x16_t>;
+constexpr auto vqaddq_u16 = __vqadd<uint16x8_t>;
+constexpr auto vqaddq_u32 = __vqadd<uint32x4_t>;
+constexpr auto vqaddq_u64 = __vqadd<uint64x2_t>;
+
+constexpr auto vqaddq_s8 = __vqadd<int8x16_t>;
+constexpr auto vqaddq_s16 = __vqadd<int16x8_t>;
+constexpr auto vqaddq_s32 = __vqadd<int32x4_t>;
+constexpr auto vqaddq_s64 = __vqadd<int64x2_t>;
+
+// a + b with the lanes wrapping as on NEON
+template <typename E>
+IRIS_INLINE constexpr E __iris__add(E a, E b)
+{
+    if constexpr (std::is_integral<E>::value)
+    {
+        using U = typename std::make_unsigned<E>::type;
+        return static_cast<E>(static_cast<U>(U(a) + U(b)));
+    }
+    else
+    {
+        return a + b;
+    }
+}
+
+// pairs of adjacent lanes of v1 fill the lower half, those of v2 the upper one
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vpadd(T v1, T v2)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vpadd<T, B>(v1, v2);
+    }
+#endif
+    using E = typename T::elementType;
+    T result;
+    const size_t half = T::length / 2;
+    for (size_t i = 0; i < half; i++)
+    {
+        result.template at<E>(i) = __iris__add(v1.template at<E>(2 * i), v1.template at<E>(2 * i + 1));
+        result.template at<E>(half + i) = __iris__add(v2.template at<E>(2 * i), v2.template at<E>(2 * i + 1));
+    }
+    return result;
+}
+
+constexpr auto vpadd_u8 = __vpadd<uint8x8_t>;
+constexpr auto vpadd_u16 = __vpadd<uint16x4_t>;
+constexpr auto vpadd_u32 = __vpadd<uint32x2_t>;
+
+constexpr auto vpadd_s8 = __vpadd<int8x8_t>;
+constexpr auto vpadd_s16 = __vpadd<int16x4_t>;
+constexpr auto vpadd_s32 = __vpadd<int32x2_t>;
+
+constexpr auto vpadd_f32 = __vpadd<float32x2_t>;
+
+// A64
+constexpr auto vpaddq_u8 = __vpadd<uint8x16_t>;
+constexpr auto vpaddq_u16 = __vpadd<uint16x8_t>;
+constexpr auto vpaddq_u32 = __vpadd<uint32x4_t>;
+constexpr auto vpaddq_u64 = __vpadd<uint64x2_t>;
+
+constexpr auto vpaddq_s8 = __vpadd<int8x16_t>;
+constexpr auto vpaddq_s16 = __vpadd<int16x8_t>;
+constexpr auto vpaddq_s32 = __vpadd<int32x4_t>;
+constexpr auto vpaddq_s64 = __vpadd<int64x2_t>;
+
+constexpr auto vpaddq_f32 = __vpadd<float32x4_t>;
+
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vpaddl(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vpaddl<T, R, B>(v);
+    }
+#endif
+    R result;
+    for (size_t i = 0; i < R::length; i++)
+    {
+        typename R::elementType x = v.template at<typename T::elementType>(2 * i);
+        typename R::elementType y = v.template at<typename T::elementType>(2 * i + 1);
+        result.template at<typename R::elementType>(i) = x + y;
+    }
+    return result;
+}
+
+constexpr auto vpaddl_u8 = __vpaddl<uint8x8_t, uint16x4_t>;
+constexpr auto vpaddl_u16 = __vpaddl<uint16x4_t, uint32x2_t>;
+constexpr auto vpaddl_u32 = __vpaddl<uint32x2_t, uint64x1_t>;
+
+constexpr auto vpaddl_s8 = __vpaddl<int8x8_t, int16x4_t>;
+constexpr auto vpaddl_s16 = __vpaddl<int16x4_t, int32x2_t>;
+constexpr auto vpaddl_s32 = __vpaddl<int32x2_t, int64x1_t>;
+
+constexpr auto vpaddlq_u8 = __vpaddl<uint8x16_t, uint16x8_t>;
+constexpr auto vpaddlq_u16 = __vpaddl<uint16x8_t, uint32x4_t>;
+constexpr auto vpaddlq_u32 = __vpaddl<uint32x4_t, uint64x2_t>;
+
+constexpr auto vpaddlq_s8 = __vpaddl<int8x16_t, int16x8_t>;
+constexpr auto vpaddlq_s16 = __vpaddl<int16x8_t, int32x4_t>;
+constexpr auto vpaddlq_s32 = __vpaddl<int32x4_t, int64x2_t>;
+
+template <typename R, typename T, typename B = backend::best>
+IRIS_INLINE constexpr R __vpadal(R v1, T v2)
+{
+    return __vadd<R, B>(v1, __vpaddl<T, R, B>(v2));
+}
+
+constexpr auto vpadal_u8 = __vpadal<uint16x4_t, uint8x8_t>;
+constexpr auto vpadal_u16 = __vpadal<uint32x2_t, uint16x4_t>;
+constexpr auto vpadal_u32 = __vpadal<uint64x1_t, uint32x2_t>;
+
+constexpr auto vpadal_s8 = __vpadal<int16x4_t, int8x8_t>;
+constexpr auto vpadal_s16 = __vpadal<int32x2_t, int16x4_t>;
+constexpr auto vpadal_s32 = __vpadal<int64x1_t, int32x2_t>;
+
+constexpr auto vpadalq_u8 = __vpadal<uint16x8_t, uint8x16_t>;
+constexpr auto vpadalq_u16 = __vpadal<uint32x4_t, uint16x8_t>;
+constexpr auto vpadalq_u32 = __vpadal<uint64x2_t, uint32x4_t>;
+
+constexpr auto vpadalq_s8 = __vpadal<int16x8_t, int8x16_t>;
+constexpr auto vpadalq_s16 = __vpadal<int32x4_t, int16x8_t>;
+constexpr auto vpadalq_s32 = __vpadal<int64x2_t, int32x4_t>;
 
 } // namespace iris::arm::addition
 using namespace iris::arm::addition;
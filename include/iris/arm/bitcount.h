@@ -0,0 +1,132 @@
+#include "common.h"
+#include "sse/bitcount.h"
+
+#ifndef IRIS_ARM_BITCOUNT
+#define IRIS_ARM_BITCOUNT
+
+namespace iris::arm::bitcount
+{
+
+// Fixed-count loops over the bits of the unsigned lane type, so every lane
+// costs the same.
+template <typename E>
+IRIS_INLINE constexpr E __iris__popcount(E x)
+{
+    using U = typename std::make_unsigned<E>::type;
+    U bits = static_cast<U>(x);
+    U count = 0;
+    for (size_t i = 0; i < sizeof(E) * 8; i++)
+    {
+        count = static_cast<U>(count + ((bits >> i) & 1));
+    }
+    return static_cast<E>(count);
+}
+
+// the width minus the bits set once the leading one is smeared to the right
+template <typename E>
+IRIS_INLINE constexpr E __iris__clz(E x)
+{
+    using U = typename std::make_unsigned<E>::type;
+    U bits = static_cast<U>(x);
+    for (size_t shift = 1; shift < sizeof(E) * 8; shift *= 2)
+    {
+        bits = static_cast<U>(bits | (bits >> shift));
+    }
+    return static_cast<E>(sizeof(E) * 8 - static_cast<size_t>(__iris__popcount(bits)));
+}
+
+// the bits below the sign bit that equal it
+template <typename E>
+IRIS_INLINE constexpr E __iris__cls(E x)
+{
+    using U = typename std::make_unsigned<E>::type;
+    U sign = static_cast<U>(U(0) - U(static_cast<U>(x) >> (sizeof(E) * 8 - 1)));
+    return static_cast<E>(__iris__clz(static_cast<U>(static_cast<U>(x) ^ sign)) - 1);
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vcnt(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vcnt<T, B>(v);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = __iris__popcount(v.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+constexpr auto vcnt_u8 = __vcnt<uint8x8_t>;
+constexpr auto vcnt_s8 = __vcnt<int8x8_t>;
+
+constexpr auto vcntq_u8 = __vcnt<uint8x16_t>;
+constexpr auto vcntq_s8 = __vcnt<int8x16_t>;
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vclz(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vclz<T, B>(v);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = __iris__clz(v.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+constexpr auto vclz_u8 = __vclz<uint8x8_t>;
+constexpr auto vclz_u16 = __vclz<uint16x4_t>;
+constexpr auto vclz_u32 = __vclz<uint32x2_t>;
+
+constexpr auto vclz_s8 = __vclz<int8x8_t>;
+constexpr auto vclz_s16 = __vclz<int16x4_t>;
+constexpr auto vclz_s32 = __vclz<int32x2_t>;
+
+constexpr auto vclzq_u8 = __vclz<uint8x16_t>;
+constexpr auto vclzq_u16 = __vclz<uint16x8_t>;
+constexpr auto vclzq_u32 = __vclz<uint32x4_t>;
+
+constexpr auto vclzq_s8 = __vclz<int8x16_t>;
+constexpr auto vclzq_s16 = __vclz<int16x8_t>;
+constexpr auto vclzq_s32 = __vclz<int32x4_t>;
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vcls(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vcls<T, B>(v);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = __iris__cls(v.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+constexpr auto vcls_s8 = __vcls<int8x8_t>;
+constexpr auto vcls_s16 = __vcls<int16x4_t>;
+constexpr auto vcls_s32 = __vcls<int32x2_t>;
+
+constexpr auto vclsq_s8 = __vcls<int8x16_t>;
+constexpr auto vclsq_s16 = __vcls<int16x8_t>;
+constexpr auto vclsq_s32 = __vcls<int32x4_t>;
+
+} // namespace iris::arm::bitcount
+
+using namespace iris::arm::bitcount;
+
+#endif
@@ -100,4 +100,55 @@ using float32x4x4_t = iris::common::multi_vector<float32x4_t, 4>;
 } // namespace iris::arm::common
 
 using namespace iris::arm::common;
+
+// Backend policies of the family templates (__vadd<T, B>, __vaddl<T, R, B>, ...).
+// Each caps the instruction set tier a template may lower to, so several can be
+// instantiated side by side in one translation unit.
+namespace iris::arm::backend
+{
+// Ordered instruction set tiers; avx2 also requires FMA3.
+enum class tier
+{
+    scalar,
+    sse2,
+    ssse3,
+    sse41,
+    avx2
+};
+
+// per-lane reference loops
+struct scalar
+{
+    static constexpr tier limit = tier::scalar;
+    static constexpr bool vector_extensions = false;
+};
+
+// GCC/Clang vector extensions only
+struct generic
+{
+    static constexpr tier limit = tier::scalar;
+    static constexpr bool vector_extensions = true;
+};
+
+// SSE2 kernels only
+struct sse2
+{
+    static constexpr tier limit = tier::sse2;
+    static constexpr bool vector_extensions = false;
+};
+
+// every tier up to AVX2/FMA3 that the build (and with IRIS_ARM_DISPATCH, the CPU) allows
+struct avx2
+{
+    static constexpr tier limit = tier::avx2;
+    static constexpr bool vector_extensions = false;
+};
+
+// the x86 kernels where there are some, vector extensions for the other families
+struct best
+{
+    static constexpr tier limit = tier::avx2;
+    static constexpr bool vector_extensions = true;
+};
+} // namespace iris::arm::backend
 #endif
\ No newline at end of file
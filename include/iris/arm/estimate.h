@@ -0,0 +1,227 @@
+#include "common.h"
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#ifndef IRIS_ARM_ESTIMATE
+#define IRIS_ARM_ESTIMATE
+
+// Reciprocal and reciprocal square root estimates as computed by Arm cores:
+// the RecipEstimate()/RecipSqrtEstimate() tables of the Arm Architecture
+// Reference Manual and the AArch64 FPRecipEstimate()/FPRSqrtEstimate() and
+// FRECPS/FRSQRTS steps for single precision, with denormals kept (FPCR.FZ = 0)
+// and round to nearest.
+namespace iris::arm::estimate
+{
+
+// 1/x for x = a / 512 in [0.5, 1), as a 9-bit value in [256, 512)
+constexpr uint32_t __recip_estimate(uint32_t a)
+{
+    a = a * 2 + 1;
+    uint32_t b = (1u << 19) / a;
+    return (b + 1) / 2;
+}
+
+// 1/sqrt(x) for x = a / 512 in [0.25, 1), as a 9-bit value in [256, 512)
+constexpr uint32_t __rsqrt_estimate(uint32_t a)
+{
+    if (a < 256)
+    {
+        a = a * 2 + 1;
+    }
+    else
+    {
+        a = ((a >> 1) << 1) + 1;
+        a = a * 2;
+    }
+    uint32_t b = 512;
+    while (uint64_t(a) * (b + 1) * (b + 1) < (uint64_t(1) << 28))
+    {
+        b++;
+    }
+    return (b + 1) / 2;
+}
+
+struct __tables
+{
+    uint32_t recip[256] = {};
+    uint32_t rsqrt[384] = {};
+
+    constexpr __tables()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            recip[i] = __recip_estimate(256 + i);
+        }
+        for (uint32_t i = 0; i < 384; i++)
+        {
+            rsqrt[i] = __rsqrt_estimate(128 + i);
+        }
+    }
+};
+
+// built once, at compile time
+inline constexpr __tables __table{};
+
+// lane bits, for float and uint32_t lanes alike
+template <typename E>
+inline uint32_t __bits(E x)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+template <typename E>
+inline E __lane(uint32_t bits)
+{
+    E x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+constexpr uint32_t __sign = 0x80000000u;
+constexpr uint32_t __infinity = 0x7f800000u;
+constexpr uint32_t __quiet = 0x00400000u;
+
+constexpr bool __is_nan(uint32_t x)
+{
+    return (x & ~__sign) > __infinity;
+}
+
+constexpr uint32_t __recpe(uint32_t x)
+{
+    uint32_t sign = x & __sign;
+    uint32_t exponent = (x >> 23) & 0xff;
+    uint32_t fraction = x & 0x7fffff;
+    if (__is_nan(x))
+    {
+        return x | __quiet;
+    }
+    if (exponent == 0xff)
+    {
+        return sign;
+    }
+    // zero, and |x| < 2^-128, whose reciprocal overflows
+    if (exponent == 0 && (fraction >> 21) == 0)
+    {
+        return sign | __infinity;
+    }
+    int32_t e = static_cast<int32_t>(exponent);
+    if (exponent == 0)
+    {
+        if ((fraction >> 22) == 0)
+        {
+            e = -1;
+            fraction = (fraction << 2) & 0x7fffff;
+        }
+        else
+        {
+            fraction = (fraction << 1) & 0x7fffff;
+        }
+    }
+    int32_t resultExponent = 253 - e;
+    uint32_t resultFraction = (__table.recip[fraction >> 15] & 0xff) << 15;
+    // denormal results
+    if (resultExponent == 0)
+    {
+        resultFraction = (1u << 22) | (resultFraction >> 1);
+    }
+    else if (resultExponent == -1)
+    {
+        resultFraction = (1u << 21) | (resultFraction >> 2);
+        resultExponent = 0;
+    }
+    return sign | (static_cast<uint32_t>(resultExponent) << 23) | resultFraction;
+}
+
+constexpr uint32_t __rsqrte(uint32_t x)
+{
+    uint32_t exponent = (x >> 23) & 0xff;
+    uint32_t fraction = x & 0x7fffff;
+    if (__is_nan(x))
+    {
+        return x | __quiet;
+    }
+    if ((x & ~__sign) == 0)
+    {
+        return x | __infinity;
+    }
+    if (x & __sign)
+    {
+        return __infinity | __quiet;
+    }
+    if (exponent == 0xff)
+    {
+        return 0;
+    }
+    int32_t e = static_cast<int32_t>(exponent);
+    if (exponent == 0)
+    {
+        while ((fraction >> 22) == 0)
+        {
+            fraction = (fraction << 1) & 0x7fffff;
+            e--;
+        }
+        fraction = (fraction << 1) & 0x7fffff;
+    }
+    // odd exponents scale the fraction to [0.25, 0.5), even ones to [0.5, 1)
+    uint32_t scaled = (e & 1) ? 128 + (fraction >> 16) : 256 + (fraction >> 15);
+    uint32_t resultExponent = static_cast<uint32_t>(380 - e) / 2;
+    return (resultExponent << 23) | ((__table.rsqrt[scaled - 128] & 0xff) << 15);
+}
+
+// URECPE and URSQRTE on unsigned fixed-point lanes in [0.5, 1) and [0.25, 1)
+constexpr uint32_t __urecpe(uint32_t x)
+{
+    return (x >> 31) == 0 ? 0xffffffffu : __table.recip[(x >> 23) - 256] << 23;
+}
+
+constexpr uint32_t __ursqrte(uint32_t x)
+{
+    return (x >> 30) == 0 ? 0xffffffffu : __table.rsqrt[(x >> 23) - 128] << 23;
+}
+
+// FPProcessNaNs() order: signalling before quiet, the first operand first
+inline uint32_t __nan(uint32_t a, uint32_t b)
+{
+    bool quietA = (a & __quiet) != 0;
+    bool quietB = (b & __quiet) != 0;
+    if (__is_nan(a) && !quietA)
+    {
+        return a | __quiet;
+    }
+    if (__is_nan(b) && !quietB)
+    {
+        return b | __quiet;
+    }
+    return __is_nan(a) ? a : b;
+}
+
+// (constant - a * b) * half with a single rounding; infinity times zero
+// gives the constant times half. Halving the operand of larger magnitude
+// instead of the fused result keeps (3 - a * b) / 2 finite where 3 - a * b
+// alone would overflow: it is exact unless both operands are tiny, and then
+// the product is far below half an ulp of the result.
+inline float __step(float a, float b, float constant, float half)
+{
+    uint32_t x = __bits(a) ^ __sign;
+    uint32_t y = __bits(b);
+    if (__is_nan(x) || __is_nan(y))
+    {
+        return __lane<float>(__nan(x, y));
+    }
+    if ((std::isinf(a) && b == 0) || (a == 0 && std::isinf(b)))
+    {
+        return constant * half;
+    }
+    if (std::fabs(a) < std::fabs(b))
+    {
+        std::swap(a, b);
+    }
+    return std::fma(-(a * half), b, constant * half);
+}
+
+} // namespace iris::arm::estimate
+
+#endif
@@ -1,18 +1,63 @@
 #include "common.h"
-#include "multiplication_addition.h"
+#include "sse/fma.h"
+#include <cmath>
+
 #ifndef IRIS_ARM_FMA
 #define IRIS_ARM_FMA
 
 namespace iris::arm::fma
 {
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vfma(T v1, T v2, T v3)
+{
+#if IRIS_ARM_FMA3
+    if (sse::__supports<B>(sse::tier::avx2))
+    {
+        return sse::__vfma(v1, v2, v3);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = std::fma(v2.template at<typename T::elementType>(i), v3.template at<typename T::elementType>(i), v1.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vfms(T v1, T v2, T v3)
+{
+#if IRIS_ARM_FMA3
+    if (sse::__supports<B>(sse::tier::avx2))
+    {
+        return sse::__vfms(v1, v2, v3);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = std::fma(-v2.template at<typename T::elementType>(i), v3.template at<typename T::elementType>(i), v1.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
 // ARM_NEON - vfma - 64-bit vector
-const auto &vfma_f32 = vmla_f32;
+constexpr auto vfma_f32 = __vfma<float32x2_t>;
 //
 
 // ARM_NEON - vfma - 128-bit vector
-const auto &vfmaq_f32 = vmlaq_f32;
+constexpr auto vfmaq_f32 = __vfma<float32x4_t>;
+//
+
+// ARM_NEON - vfms - 64-bit vector
+constexpr auto vfms_f32 = __vfms<float32x2_t>;
+//
+
+// ARM_NEON - vfms - 128-bit vector
+constexpr auto vfmsq_f32 = __vfms<float32x4_t>;
 } // namespace iris::arm::fma
 
 using namespace iris::arm::fma;
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,49 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_GNU_BITWISE
+#define IRIS_ARM_GNU_BITWISE
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vand(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v1) & __load<W>(v2));
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vorr(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v1) | __load<W>(v2));
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __veor(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v1) ^ __load<W>(v2));
+}
+
+// same operands as the reference templates in arm/bitwise.h
+template <typename T>
+IRIS_FORCE_INLINE T __vbic(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(~(__load<W>(v1) & __load<W>(v2)));
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vorn(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(~(__load<W>(v1) | __load<W>(v2)));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
@@ -0,0 +1,85 @@
+#include "../sse/common.h"
+#include <cstring>
+
+#ifndef IRIS_ARM_GNU_COMMON
+#define IRIS_ARM_GNU_COMMON
+
+// Lowering of the element-wise NEON families to GCC/Clang vector extensions;
+// the compiler emits whatever SIMD the target has (SSE, NEON, VSX, RVV, ...).
+// IRIS_ARM_SCALAR turns it off together with the SSE kernels.
+#if !defined(IRIS_ARM_SCALAR) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9))
+#define IRIS_ARM_GNU 1
+#else
+#define IRIS_ARM_GNU 0
+#endif
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+using backend::tier;
+
+// bytes / sizeof(E) lanes of E; GCC only applies vector_size to a dependent
+// type through a member typedef
+template <typename E, size_t bytes>
+struct __vector_of
+{
+    typedef E type __attribute__((vector_size(bytes)));
+};
+
+template <typename E, size_t bytes>
+using __vec = typename __vector_of<E, bytes>::type;
+
+// Integer arithmetic runs on unsigned lanes so that overflow wraps as on NEON.
+template <typename E>
+using __wrap = typename std::conditional<std::is_integral<E>::value, std::make_unsigned<E>, std::common_type<E>>::type::type;
+
+// Whether backend B may take the vector extension kernels; a runtime
+// dispatched build forced to the scalar tier keeps the reference loops, and
+// so does constant evaluation.
+template <typename B>
+IRIS_FORCE_INLINE constexpr bool __supports()
+{
+#if IRIS_ARM_RUNTIME
+    return !IRIS_CONSTANT_EVALUATED() && B::vector_extensions && sse::__active_tier() != tier::scalar;
+#else
+    return !IRIS_CONSTANT_EVALUATED() && B::vector_extensions;
+#endif
+}
+
+template <typename E, typename T>
+IRIS_FORCE_INLINE __vec<E, T::byteSize> __load(const T &v)
+{
+    __vec<E, T::byteSize> x;
+    std::memcpy(&x, &v.value, sizeof(x));
+    return x;
+}
+
+template <typename T, typename V>
+IRIS_FORCE_INLINE T __store(V x)
+{
+    static_assert(sizeof(V) == T::byteSize, "vector size mismatch");
+    T result;
+    std::memcpy(&result.value, &x, sizeof(x));
+    return result;
+}
+
+// Sign or zero extends the lanes of v to W lanes, as the element types of T and R.
+template <typename W, typename R, typename T>
+IRIS_FORCE_INLINE __vec<W, R::byteSize> __widen(const T &v)
+{
+    using E = typename R::elementType;
+    return (__vec<W, R::byteSize>)__builtin_convertvector(__load<typename T::elementType>(v), __vec<E, R::byteSize>);
+}
+
+// mask ? a : b, with mask lanes all ones or all zeros
+template <typename V, typename M>
+IRIS_FORCE_INLINE V __select(M mask, V a, V b)
+{
+    return (V)(((M)a & mask) | ((M)b & ~mask));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
@@ -0,0 +1,56 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_GNU_COMPARISON
+#define IRIS_ARM_GNU_COMPARISON
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+// vector comparisons already produce all-ones or all-zeros lanes
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vtst(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<R>((__load<W>(v1) & __load<W>(v2)) != 0);
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vceq(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__load<E>(v1) == __load<E>(v2));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcgt(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__load<E>(v1) > __load<E>(v2));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcge(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__load<E>(v1) >= __load<E>(v2));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vclt(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__load<E>(v1) < __load<E>(v2));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcle(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__load<E>(v1) <= __load<E>(v2));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_GNU_MULTIPLICATION
+#define IRIS_ARM_GNU_MULTIPLICATION
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vmul(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v1) * __load<W>(v2));
+}
+
+// the widened products always fit, so the wrapping multiply is exact
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vmull(T v1, T v2)
+{
+    using W = __wrap<typename R::elementType>;
+    return __store<R>(__widen<W, R>(v1) * __widen<W, R>(v2));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
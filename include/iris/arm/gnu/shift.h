@@ -0,0 +1,44 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_GNU_SHIFT
+#define IRIS_ARM_GNU_SHIFT
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+// Callers keep shift below the lane width; vector shifts past it are undefined.
+template <typename T>
+IRIS_FORCE_INLINE T __vshl_n(T v, uint32_t shift)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v) << static_cast<W>(shift));
+}
+
+// arithmetic for signed lanes, logical for unsigned ones
+template <typename T>
+IRIS_FORCE_INLINE T __vshr_n(T v, uint32_t shift)
+{
+    using E = typename T::elementType;
+    return __store<T>(__load<E>(v) >> static_cast<E>(shift));
+}
+
+// immediate forms, n below the lane width: a single shift by a constant
+template <uint32_t n, typename T>
+IRIS_FORCE_INLINE T __vshl_n(T v)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v) << static_cast<W>(n));
+}
+
+template <uint32_t n, typename T>
+IRIS_FORCE_INLINE T __vshr_n(T v)
+{
+    using E = typename T::elementType;
+    return __store<T>(__load<E>(v) >> static_cast<E>(n));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
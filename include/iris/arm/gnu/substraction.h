@@ -0,0 +1,34 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_GNU_SUBSTRACTION
+#define IRIS_ARM_GNU_SUBSTRACTION
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vsub(T v1, T v2)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(__load<W>(v1) - __load<W>(v2));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vsubl(T v1, T v2)
+{
+    using W = __wrap<typename R::elementType>;
+    return __store<R>(__widen<W, R>(v1) - __widen<W, R>(v2));
+}
+
+template <typename R, typename T>
+IRIS_FORCE_INLINE R __vsubw(R v1, T v2)
+{
+    using W = __wrap<typename R::elementType>;
+    return __store<R>(__load<W>(v1) - __widen<W, R>(v2));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
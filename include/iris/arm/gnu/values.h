@@ -0,0 +1,39 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_GNU_VALUES
+#define IRIS_ARM_GNU_VALUES
+
+#if IRIS_ARM_GNU
+namespace iris::arm::gnu
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vneg(T v)
+{
+    using W = __wrap<typename T::elementType>;
+    return __store<T>(-__load<W>(v));
+}
+
+// a > b ? a : b per lane; NaN lanes pick b like the reference loop
+template <typename T>
+IRIS_FORCE_INLINE T __vmax(T v1, T v2)
+{
+    using E = typename T::elementType;
+    auto a = __load<E>(v1);
+    auto b = __load<E>(v2);
+    return __store<T>(__select(a > b, a, b));
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vmin(T v1, T v2)
+{
+    using E = typename T::elementType;
+    auto a = __load<E>(v1);
+    auto b = __load<E>(v2);
+    return __store<T>(__select(a < b, a, b));
+}
+
+} // namespace iris::arm::gnu
+#endif
+
+#endif
@@ -0,0 +1,375 @@
+#include "common.h"
+#include "gnu/common.h"
+#include <cmath>
+#include <type_traits>
+
+#ifndef IRIS_ARM_LAZY
+#define IRIS_ARM_LAZY
+
+// Lazy element-wise intrinsics. lazy::vaddq(lazy::vmulq(a, b), c) builds an
+// expression node instead of a vector, and converting the node to its vector
+// type evaluates the whole tree at once: in vector registers with the vector
+// extension kernels, otherwise (and during constant evaluation) in a single
+// lane loop. Nodes hold their operands by value, so they can be kept in
+// `auto` variables and passed to the regular intrinsics.
+namespace iris::arm::lazy
+{
+
+// Integer lanes wrap as in the per-lane templates, see common::wrap_lane.
+template <typename E>
+using __lane = iris::common::wrap_lane<E>;
+
+template <typename T>
+struct __leaf
+{
+    using type = T;
+    using E = typename T::elementType;
+
+    T value;
+
+    IRIS_INLINE constexpr __lane<E> lane(size_t i) const
+    {
+        return static_cast<__lane<E>>(value.template at<E>(i));
+    }
+
+#if IRIS_ARM_GNU
+    IRIS_INLINE auto vec() const
+    {
+        return gnu::__load<gnu::__wrap<E>>(value);
+    }
+#endif
+};
+
+template <typename N>
+IRIS_INLINE constexpr typename N::type __eval(const N &n)
+{
+    using T = typename N::type;
+    using E = typename T::elementType;
+#if IRIS_ARM_GNU
+    if (gnu::__supports<backend::best>())
+    {
+        return gnu::__store<T>(n.vec());
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<E>(i) = static_cast<E>(n.lane(i));
+    }
+    return result;
+}
+
+// Op::apply takes lane values or whole vector extension registers.
+template <typename Op, typename A>
+struct __unary
+{
+    using type = typename A::type;
+
+    A a;
+    Op op;
+
+    IRIS_INLINE constexpr auto lane(size_t i) const { return op.apply(a.lane(i)); }
+#if IRIS_ARM_GNU
+    IRIS_INLINE auto vec() const { return op.apply(a.vec()); }
+#endif
+    constexpr operator type() const { return __eval(*this); }
+};
+
+template <typename Op, typename A, typename B>
+struct __binary
+{
+    using type = typename A::type;
+
+    A a;
+    B b;
+
+    IRIS_INLINE constexpr auto lane(size_t i) const { return Op::apply(a.lane(i), b.lane(i)); }
+#if IRIS_ARM_GNU
+    IRIS_INLINE auto vec() const { return Op::apply(a.vec(), b.vec()); }
+#endif
+    constexpr operator type() const { return __eval(*this); }
+};
+
+template <typename Op, typename A, typename B, typename C>
+struct __ternary
+{
+    using type = typename A::type;
+
+    A a;
+    B b;
+    C c;
+
+    IRIS_INLINE constexpr auto lane(size_t i) const { return Op::apply(a.lane(i), b.lane(i), c.lane(i)); }
+#if IRIS_ARM_GNU
+    IRIS_INLINE auto vec() const { return Op::apply(a.vec(), b.vec(), c.vec()); }
+#endif
+    constexpr operator type() const { return __eval(*this); }
+};
+
+template <typename A>
+struct __is_node : std::false_type
+{
+};
+
+template <typename Op, typename A>
+struct __is_node<__unary<Op, A>> : std::true_type
+{
+};
+
+template <typename Op, typename A, typename B>
+struct __is_node<__binary<Op, A, B>> : std::true_type
+{
+};
+
+template <typename Op, typename A, typename B, typename C>
+struct __is_node<__ternary<Op, A, B, C>> : std::true_type
+{
+};
+
+// vectors become leaves, nodes are used as they are
+template <typename A>
+IRIS_INLINE constexpr auto __operand(const A &a)
+{
+    if constexpr (__is_node<A>::value)
+    {
+        return a;
+    }
+    else
+    {
+        return __leaf<A>{a};
+    }
+}
+
+template <typename A>
+using __operand_t = decltype(__operand(std::declval<A>()));
+
+template <typename A>
+using __value_t = typename __operand_t<A>::type;
+
+// d forms take 64-bit vectors, q forms 128-bit ones
+template <size_t bytes, typename A, typename... R>
+constexpr bool __check()
+{
+    static_assert((std::is_same<__value_t<A>, __value_t<R>>::value && ...), "lazy operands have different vector types");
+    static_assert(__value_t<A>::byteSize == bytes, "lazy d forms take 64-bit vectors, q forms 128-bit ones");
+    return true;
+}
+
+struct __add
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y) { return x + y; }
+};
+
+struct __sub
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y) { return x - y; }
+};
+
+struct __mul
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y) { return x * y; }
+};
+
+struct __and
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y) { return x & y; }
+};
+
+struct __orr
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y) { return x | y; }
+};
+
+struct __eor
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y) { return x ^ y; }
+};
+
+// x + y * z with a single rounding
+struct __fma
+{
+    template <typename X>
+    IRIS_INLINE static constexpr X apply(X x, X y, X z)
+    {
+        if constexpr (std::is_arithmetic<X>::value)
+        {
+            return std::fma(y, z, x);
+        }
+        else
+        {
+            for (size_t i = 0; i < sizeof(X) / sizeof(x[0]); i++)
+            {
+                x[i] = std::fma(y[i], z[i], x[i]);
+            }
+            return x;
+        }
+    }
+};
+
+template <typename E>
+struct __shl
+{
+    uint32_t shift;
+
+    template <typename X>
+    IRIS_INLINE constexpr X apply(X x) const { return x << shift; }
+};
+
+// arithmetic for signed lanes: the wrapped lane is truncated to E first;
+// shifts by the full lane width leave the sign or zero
+template <typename E>
+struct __shr
+{
+    uint32_t shift;
+
+    template <typename X>
+    IRIS_INLINE constexpr X apply(X x) const
+    {
+        constexpr uint32_t bits = sizeof(E) * 8;
+        uint32_t n = std::is_signed<E>::value && shift >= bits ? bits - 1 : shift;
+        if (n >= bits)
+        {
+            return x ^ x;
+        }
+        if constexpr (std::is_arithmetic<X>::value)
+        {
+            return static_cast<X>(static_cast<E>(x) >> n);
+        }
+        else
+        {
+#if IRIS_ARM_GNU
+            return (X)((gnu::__vec<E, sizeof(X)>)x >> static_cast<E>(n));
+#endif
+        }
+    }
+};
+
+template <typename Op, typename A, typename B>
+IRIS_INLINE constexpr auto __make(const A &a, const B &b)
+{
+    return __binary<Op, __operand_t<A>, __operand_t<B>>{__operand(a), __operand(b)};
+}
+
+template <typename Op, typename A, typename B, typename C>
+IRIS_INLINE constexpr auto __make(const A &a, const B &b, const C &c)
+{
+    return __ternary<Op, __operand_t<A>, __operand_t<B>, __operand_t<C>>{__operand(a), __operand(b), __operand(c)};
+}
+
+// Forces evaluation, e.g. of an `auto` node.
+template <typename A>
+IRIS_INLINE constexpr __value_t<A> eval(const A &a)
+{
+    return __eval(__operand(a));
+}
+
+template <typename A, typename B, bool = __check<8, A, B>()>
+IRIS_INLINE constexpr auto vadd(const A &a, const B &b) { return __make<__add>(a, b); }
+
+template <typename A, typename B, bool = __check<16, A, B>()>
+IRIS_INLINE constexpr auto vaddq(const A &a, const B &b) { return __make<__add>(a, b); }
+
+template <typename A, typename B, bool = __check<8, A, B>()>
+IRIS_INLINE constexpr auto vsub(const A &a, const B &b) { return __make<__sub>(a, b); }
+
+template <typename A, typename B, bool = __check<16, A, B>()>
+IRIS_INLINE constexpr auto vsubq(const A &a, const B &b) { return __make<__sub>(a, b); }
+
+template <typename A, typename B, bool = __check<8, A, B>()>
+IRIS_INLINE constexpr auto vmul(const A &a, const B &b) { return __make<__mul>(a, b); }
+
+template <typename A, typename B, bool = __check<16, A, B>()>
+IRIS_INLINE constexpr auto vmulq(const A &a, const B &b) { return __make<__mul>(a, b); }
+
+// a + b * c; on integer lanes one multiply-add per lane, on float lanes a
+// rounded product then a rounded sum as on NEON (see vfma for one rounding)
+template <typename A, typename B, typename C, bool = __check<8, A, B, C>()>
+IRIS_INLINE constexpr auto vmla(const A &a, const B &b, const C &c) { return vadd(a, vmul(b, c)); }
+
+template <typename A, typename B, typename C, bool = __check<16, A, B, C>()>
+IRIS_INLINE constexpr auto vmlaq(const A &a, const B &b, const C &c) { return vaddq(a, vmulq(b, c)); }
+
+template <typename A, typename B, typename C, bool = __check<8, A, B, C>()>
+IRIS_INLINE constexpr auto vmls(const A &a, const B &b, const C &c) { return vsub(a, vmul(b, c)); }
+
+template <typename A, typename B, typename C, bool = __check<16, A, B, C>()>
+IRIS_INLINE constexpr auto vmlsq(const A &a, const B &b, const C &c) { return vsubq(a, vmulq(b, c)); }
+
+template <typename A, typename B, typename C, bool = __check<8, A, B, C>()>
+IRIS_INLINE constexpr auto vfma(const A &a, const B &b, const C &c)
+{
+    static_assert(std::is_floating_point<typename __value_t<A>::elementType>::value, "vfma takes float vectors");
+    return __make<__fma>(a, b, c);
+}
+
+template <typename A, typename B, typename C, bool = __check<16, A, B, C>()>
+IRIS_INLINE constexpr auto vfmaq(const A &a, const B &b, const C &c)
+{
+    static_assert(std::is_floating_point<typename __value_t<A>::elementType>::value, "vfmaq takes float vectors");
+    return __make<__fma>(a, b, c);
+}
+
+template <typename A, typename B, bool = __check<8, A, B>()>
+IRIS_INLINE constexpr auto vand(const A &a, const B &b) { return __make<__and>(a, b); }
+
+template <typename A, typename B, bool = __check<16, A, B>()>
+IRIS_INLINE constexpr auto vandq(const A &a, const B &b) { return __make<__and>(a, b); }
+
+template <typename A, typename B, bool = __check<8, A, B>()>
+IRIS_INLINE constexpr auto vorr(const A &a, const B &b) { return __make<__orr>(a, b); }
+
+template <typename A, typename B, bool = __check<16, A, B>()>
+IRIS_INLINE constexpr auto vorrq(const A &a, const B &b) { return __make<__orr>(a, b); }
+
+template <typename A, typename B, bool = __check<8, A, B>()>
+IRIS_INLINE constexpr auto veor(const A &a, const B &b) { return __make<__eor>(a, b); }
+
+template <typename A, typename B, bool = __check<16, A, B>()>
+IRIS_INLINE constexpr auto veorq(const A &a, const B &b) { return __make<__eor>(a, b); }
+
+// shift counts as template arguments, checked as for the eager forms
+template <uint32_t n, typename A, bool = __check<8, A>()>
+IRIS_INLINE constexpr auto vshl_n(const A &a)
+{
+    using E = typename __value_t<A>::elementType;
+    static_assert(std::is_integral<E>::value, "lazy shifts take integer vectors");
+    static_assert(n < sizeof(E) * 8, "vshl_n shift out of range");
+    return __unary<__shl<E>, __operand_t<A>>{__operand(a), {n}};
+}
+
+template <uint32_t n, typename A, bool = __check<16, A>()>
+IRIS_INLINE constexpr auto vshlq_n(const A &a)
+{
+    using E = typename __value_t<A>::elementType;
+    static_assert(std::is_integral<E>::value, "lazy shifts take integer vectors");
+    static_assert(n < sizeof(E) * 8, "vshlq_n shift out of range");
+    return __unary<__shl<E>, __operand_t<A>>{__operand(a), {n}};
+}
+
+template <uint32_t n, typename A, bool = __check<8, A>()>
+IRIS_INLINE constexpr auto vshr_n(const A &a)
+{
+    using E = typename __value_t<A>::elementType;
+    static_assert(std::is_integral<E>::value, "lazy shifts take integer vectors");
+    static_assert(n >= 1 && n <= sizeof(E) * 8, "vshr_n shift out of range");
+    return __unary<__shr<E>, __operand_t<A>>{__operand(a), {n}};
+}
+
+template <uint32_t n, typename A, bool = __check<16, A>()>
+IRIS_INLINE constexpr auto vshrq_n(const A &a)
+{
+    using E = typename __value_t<A>::elementType;
+    static_assert(std::is_integral<E>::value, "lazy shifts take integer vectors");
+    static_assert(n >= 1 && n <= sizeof(E) * 8, "vshrq_n shift out of range");
+    return __unary<__shr<E>, __operand_t<A>>{__operand(a), {n}};
+}
+
+} // namespace iris::arm::lazy
+
+#endif
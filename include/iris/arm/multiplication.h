@@ -1,43 +1,65 @@
 #include "common.h"
+#include "sse/multiplication.h"
+#include "gnu/multiplication.h"
 #ifndef IRIS_ARM_MULTIPLICATION
 #define IRIS_ARM_MULTIPLICATION
 
 namespace iris::arm::multiplication {
 
-template <typename T>
-T __vmul(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vmul(T v1, T v2)
 {
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vmul(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(i) * v2.template at<typename T::elementType>(i);
+        using E = typename T::elementType;
+        using W = iris::common::wrap_lane<E>;
+        result.template at<E>(i) = static_cast<E>(static_cast<W>(v1.template at<E>(i)) * static_cast<W>(v2.template at<E>(i)));
     }
     return result;
 }
 
-const auto &vmul_u8 = __vmul<uint8x8_t>;
-const auto &vmul_u16 = __vmul<uint16x4_t>;
-const auto &vmul_u32 = __vmul<uint32x2_t>;
+constexpr auto vmul_u8 = __vmul<uint8x8_t>;
+constexpr auto vmul_u16 = __vmul<uint16x4_t>;
+constexpr auto vmul_u32 = __vmul<uint32x2_t>;
 
-const auto &vmul_s8 = __vmul<int8x8_t>;
-const auto &vmul_s16 = __vmul<int16x4_t>;
-const auto &vmul_s32 = __vmul<int32x2_t>;
+constexpr auto vmul_s8 = __vmul<int8x8_t>;
+constexpr auto vmul_s16 = __vmul<int16x4_t>;
+constexpr auto vmul_s32 = __vmul<int32x2_t>;
 
-const auto &vmul_f32 = __vmul<float32x2_t>;
+constexpr auto vmul_f32 = __vmul<float32x2_t>;
 
-const auto &vmulq_u8 = __vmul<uint8x16_t>;
-const auto &vmulq_u16 = __vmul<uint16x8_t>;
-const auto &vmulq_u32 = __vmul<uint32x4_t>;
+constexpr auto vmulq_u8 = __vmul<uint8x16_t>;
+constexpr auto vmulq_u16 = __vmul<uint16x8_t>;
+constexpr auto vmulq_u32 = __vmul<uint32x4_t>;
 
-const auto &vmulq_s8 = __vmul<int8x16_t>;
-const auto &vmulq_s16 = __vmul<int16x8_t>;
-const auto &vmulq_s32 = __vmul<int32x4_t>;
+constexpr auto vmulq_s8 = __vmul<int8x16_t>;
+constexpr auto vmulq_s16 = __vmul<int16x8_t>;
+constexpr auto vmulq_s32 = __vmul<int32x4_t>;
 
-const auto &vmulq_f32 = __vmul<float32x4_t>;
+constexpr auto vmulq_f32 = __vmul<float32x4_t>;
 
-template <typename T, typename R>
-R __vmull(T v1, T v2)
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vmull(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vmull<T, R, B>(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vmull<T, R>(v1, v2);
+    }
+#endif
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
@@ -46,59 +68,242 @@ R __vmull(T v1, T v2)
     return result;
 }
 
-const auto &vmull_s8 = __vmull<int8x8_t, int16x8_t>;
-const auto &vmull_s16 = __vmull<int16x4_t, int32x4_t>;
-const auto &vmull_s32 = __vmull<int32x2_t, int64x2_t>;
+constexpr auto vmull_s8 = __vmull<int8x8_t, int16x8_t>;
+constexpr auto vmull_s16 = __vmull<int16x4_t, int32x4_t>;
+constexpr auto vmull_s32 = __vmull<int32x2_t, int64x2_t>;
 
-const auto &vmull_u8 = __vmull<uint8x8_t, uint16x8_t>;
-const auto &vmull_u16 = __vmull<uint16x4_t, uint32x4_t>;
-const auto &vmull_u32 = __vmull<uint32x2_t, uint64x2_t>;
+constexpr auto vmull_u8 = __vmull<uint8x8_t, uint16x8_t>;
+constexpr auto vmull_u16 = __vmull<uint16x4_t, uint32x4_t>;
+constexpr auto vmull_u32 = __vmull<uint32x2_t, uint64x2_t>;
 
 template <typename T>
-T __vmul_lane(T v1, T v2, int32_t x)
+IRIS_INLINE constexpr T __vmul_lane(T v1, T v2, int32_t x)
 {
     T p = __vdup_lane<T, typename T::elementType>(v2, x);
     return __vmul(v1, p);
 }
 
-const auto &vmul_lane_s16 = __vmul_lane<int16x4_t>;
-const auto &vmul_lane_s32 = __vmul_lane<int32x2_t>;
+template <size_t n, typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vmul_lane(T v1, T v2)
+{
+    static_assert(n < T::length, "vmul_lane lane out of range");
+    return __vmul<T, B>(v1, __vdup_lane<n, T, B>(v2));
+}
+
+constexpr auto vmul_lane_s16 = __vmul_lane<int16x4_t>;
+constexpr auto vmul_lane_s32 = __vmul_lane<int32x2_t>;
 
-const auto &vmul_lane_u16 = __vmul_lane<uint16x4_t>;
-const auto &vmul_lane_u32 = __vmul_lane<uint32x2_t>;
+constexpr auto vmul_lane_u16 = __vmul_lane<uint16x4_t>;
+constexpr auto vmul_lane_u32 = __vmul_lane<uint32x2_t>;
 
-const auto &vmul_lane_f32 = __vmul_lane<float32x2_t>;
+constexpr auto vmul_lane_f32 = __vmul_lane<float32x2_t>;
 
-const auto &vmulq_lane_s16 = __vmul_lane<int16x8_t>;
-const auto &vmulq_lane_s32 = __vmul_lane<int32x4_t>;
+constexpr auto vmulq_lane_s16 = __vmul_lane<int16x8_t>;
+constexpr auto vmulq_lane_s32 = __vmul_lane<int32x4_t>;
 
-const auto &vmulq_lane_u16 = __vmul_lane<uint16x8_t>;
-const auto &vmulq_lane_u32 = __vmul_lane<uint32x4_t>;
+constexpr auto vmulq_lane_u16 = __vmul_lane<uint16x8_t>;
+constexpr auto vmulq_lane_u32 = __vmul_lane<uint32x4_t>;
 
-const auto &vmulq_lane_f32 = __vmul_lane<float32x4_t>;
+constexpr auto vmulq_lane_f32 = __vmul_lane<float32x4_t>;
 
 
 
 template <typename T>
-T __vmul_n(T v, typename T::elementType x)
+IRIS_INLINE constexpr T __vmul_n(T v, typename T::elementType x)
 {
     return __vmul(v, __vdup<T, typename T::elementType>(x));
 }
-const auto &vmul_n_s16 = __vmul_n<int16x4_t>;
-const auto &vmul_n_s32 = __vmul_n<int32x2_t>;
+constexpr auto vmul_n_s16 = __vmul_n<int16x4_t>;
+constexpr auto vmul_n_s32 = __vmul_n<int32x2_t>;
+
+constexpr auto vmul_n_u16 = __vmul_n<uint16x4_t>;
+constexpr auto vmul_n_u32 = __vmul_n<uint32x2_t>;
+
+constexpr auto vmul_n_f32 = __vmul_n<float32x2_t>;
+
+constexpr auto vmulq_n_s16 = __vmul_n<int16x8_t>;
+constexpr auto vmulq_n_s32 = __vmul_n<int32x4_t>;
+
+constexpr auto vmulq_n_u16 = __vmul_n<uint16x8_t>;
+constexpr auto vmulq_n_u32 = __vmul_n<uint32x4_t>;
+
+constexpr auto vmulq_n_f32 = __vmul_n<float32x4_t>;
+
+// 2ab in twice the width of the lanes, saturated: only min * min overflows
+template <typename E, typename W = typename std::conditional<sizeof(E) == 2, int32_t, int64_t>::type>
+IRIS_INLINE constexpr W __iris__qdmull(E a, E b)
+{
+    W product = static_cast<W>(a) * static_cast<W>(b);
+    return __iris__qadd(product, product);
+}
+
+template <typename E>
+IRIS_INLINE constexpr E __iris__qdmulh(E a, E b)
+{
+    return static_cast<E>(__iris__qdmull(a, b) >> (sizeof(E) * 8));
+}
+
+template <typename E>
+IRIS_INLINE constexpr E __iris__qrdmulh(E a, E b)
+{
+    auto doubled = __iris__qdmull(a, b);
+    decltype(doubled) round = decltype(doubled)(1) << (sizeof(E) * 8 - 1);
+    return static_cast<E>(__iris__qadd(doubled, round) >> (sizeof(E) * 8));
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vqdmulh(T v1, T v2)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqdmulh<false, T, B>(v1, v2);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = __iris__qdmulh(v1.template at<typename T::elementType>(i), v2.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+constexpr auto vqdmulh_s16 = __vqdmulh<int16x4_t>;
+constexpr auto vqdmulh_s32 = __vqdmulh<int32x2_t>;
+
+constexpr auto vqdmulhq_s16 = __vqdmulh<int16x8_t>;
+constexpr auto vqdmulhq_s32 = __vqdmulh<int32x4_t>;
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vqrdmulh(T v1, T v2)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqdmulh<true, T, B>(v1, v2);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename T::elementType>(i) = __iris__qrdmulh(v1.template at<typename T::elementType>(i), v2.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+constexpr auto vqrdmulh_s16 = __vqrdmulh<int16x4_t>;
+constexpr auto vqrdmulh_s32 = __vqrdmulh<int32x2_t>;
+
+constexpr auto vqrdmulhq_s16 = __vqrdmulh<int16x8_t>;
+constexpr auto vqrdmulhq_s32 = __vqrdmulh<int32x4_t>;
+
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vqdmull(T v1, T v2)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqdmull<T, R, B>(v1, v2);
+    }
+#endif
+    R result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<typename R::elementType>(i) = __iris__qdmull(v1.template at<typename T::elementType>(i), v2.template at<typename T::elementType>(i));
+    }
+    return result;
+}
+
+constexpr auto vqdmull_s16 = __vqdmull<int16x4_t, int32x4_t>;
+constexpr auto vqdmull_s32 = __vqdmull<int32x2_t, int64x2_t>;
+
+// The _n forms take a scalar, the _lane forms a lane of a 64-bit vector L.
+template <typename T>
+IRIS_INLINE constexpr T __vqdmulh_n(T v, typename T::elementType x)
+{
+    return __vqdmulh(v, __vdup<T, typename T::elementType>(x));
+}
+
+template <typename T, typename L>
+IRIS_INLINE constexpr T __vqdmulh_lane(T v1, L v2, int32_t lane)
+{
+    return __vqdmulh_n(v1, __vget_lane<L, typename L::elementType>(v2, lane));
+}
+
+constexpr auto vqdmulh_n_s16 = __vqdmulh_n<int16x4_t>;
+constexpr auto vqdmulh_n_s32 = __vqdmulh_n<int32x2_t>;
+constexpr auto vqdmulhq_n_s16 = __vqdmulh_n<int16x8_t>;
+constexpr auto vqdmulhq_n_s32 = __vqdmulh_n<int32x4_t>;
+
+constexpr auto vqdmulh_lane_s16 = __vqdmulh_lane<int16x4_t, int16x4_t>;
+constexpr auto vqdmulh_lane_s32 = __vqdmulh_lane<int32x2_t, int32x2_t>;
+constexpr auto vqdmulhq_lane_s16 = __vqdmulh_lane<int16x8_t, int16x4_t>;
+constexpr auto vqdmulhq_lane_s32 = __vqdmulh_lane<int32x4_t, int32x2_t>;
+
+template <typename T>
+IRIS_INLINE constexpr T __vqrdmulh_n(T v, typename T::elementType x)
+{
+    return __vqrdmulh(v, __vdup<T, typename T::elementType>(x));
+}
 
-const auto &vmul_n_u16 = __vmul_n<uint16x4_t>;
-const auto &vmul_n_u32 = __vmul_n<uint32x2_t>;
+template <typename T, typename L>
+IRIS_INLINE constexpr T __vqrdmulh_lane(T v1, L v2, int32_t lane)
+{
+    return __vqrdmulh_n(v1, __vget_lane<L, typename L::elementType>(v2, lane));
+}
 
-const auto &vmul_n_f32 = __vmul_n<float32x2_t>;
+constexpr auto vqrdmulh_n_s16 = __vqrdmulh_n<int16x4_t>;
+constexpr auto vqrdmulh_n_s32 = __vqrdmulh_n<int32x2_t>;
+constexpr auto vqrdmulhq_n_s16 = __vqrdmulh_n<int16x8_t>;
+constexpr auto vqrdmulhq_n_s32 = __vqrdmulh_n<int32x4_t>;
 
-const auto &vmulq_n_s16 = __vmul_n<int16x8_t>;
-const auto &vmulq_n_s32 = __vmul_n<int32x4_t>;
+constexpr auto vqrdmulh_lane_s16 = __vqrdmulh_lane<int16x4_t, int16x4_t>;
+constexpr auto vqrdmulh_lane_s32 = __vqrdmulh_lane<int32x2_t, int32x2_t>;
+constexpr auto vqrdmulhq_lane_s16 = __vqrdmulh_lane<int16x8_t, int16x4_t>;
+constexpr auto vqrdmulhq_lane_s32 = __vqrdmulh_lane<int32x4_t, int32x2_t>;
 
-const auto &vmulq_n_u16 = __vmul_n<uint16x8_t>;
-const auto &vmulq_n_u32 = __vmul_n<uint32x4_t>;
+template <typename T, typename R>
+IRIS_INLINE constexpr R __vqdmull_n(T v, typename T::elementType x)
+{
+    return __vqdmull<T, R>(v, __vdup<T, typename T::elementType>(x));
+}
 
-const auto &vmulq_n_f32 = __vmul_n<float32x4_t>;
+template <typename T, typename R>
+IRIS_INLINE constexpr R __vqdmull_lane(T v1, T v2, int32_t lane)
+{
+    return __vqdmull_n<T, R>(v1, __vget_lane<T, typename T::elementType>(v2, lane));
+}
+
+constexpr auto vqdmull_n_s16 = __vqdmull_n<int16x4_t, int32x4_t>;
+constexpr auto vqdmull_n_s32 = __vqdmull_n<int32x2_t, int64x2_t>;
+
+constexpr auto vqdmull_lane_s16 = __vqdmull_lane<int16x4_t, int32x4_t>;
+constexpr auto vqdmull_lane_s32 = __vqdmull_lane<int32x2_t, int64x2_t>;
+
+// Template-immediate forms, e.g. vmulq_lane<2>(v1, v2).
+template <size_t n, typename T>
+IRIS_INLINE constexpr T vmul_lane(T v1, T v2)
+{
+    static_assert(T::byteSize == 8, "vmul_lane takes 64-bit vectors");
+    return __vmul_lane<n, T>(v1, v2);
+}
+
+// the lane comes from a 64-bit vector, as in NEON; laneq takes a 128-bit one
+template <size_t n, typename T, typename L>
+IRIS_INLINE constexpr T vmulq_lane(T v1, L v2)
+{
+    static_assert(T::byteSize == 16 && L::byteSize == 8, "vmulq_lane takes a 128-bit vector and a 64-bit lane vector");
+    static_assert(std::is_same<typename T::elementType, typename L::elementType>::value, "vmulq_lane lane type mismatch");
+    static_assert(n < L::length, "vmulq_lane lane out of range");
+    return __vmul_lane<n, T>(v1, __vcombine<L, T>(v2, v2));
+}
+
+template <size_t n, typename T>
+IRIS_INLINE constexpr T vmulq_laneq(T v1, T v2)
+{
+    static_assert(T::byteSize == 16, "vmulq_laneq takes 128-bit vectors");
+    return __vmul_lane<n, T>(v1, v2);
+}
 
 }
 
@@ -6,92 +6,150 @@
 namespace iris::arm::multiplication_addition
 {
 
-template <typename T>
-T __vmla(T v1, T v2, T v3)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vmla(T v1, T v2, T v3)
 {
-    return __vadd(v3, __vmul(v1, v2));
+    return __vadd<T, B>(v1, __vmul<T, B>(v2, v3));
 }
 
-const auto &vmla_s8 = __vmla<int8x8_t>;
-const auto &vmla_s16 = __vmla<int16x4_t>;
-const auto &vmla_s32 = __vmla<int32x2_t>;
+constexpr auto vmla_s8 = __vmla<int8x8_t>;
+constexpr auto vmla_s16 = __vmla<int16x4_t>;
+constexpr auto vmla_s32 = __vmla<int32x2_t>;
+
+constexpr auto vmla_u8 = __vmla<uint8x8_t>;
+constexpr auto vmla_u16 = __vmla<uint16x4_t>;
+constexpr auto vmla_u32 = __vmla<uint32x2_t>;
+
+constexpr auto vmla_f32 = __vmla<float32x2_t>;
+
+constexpr auto vmlaq_s8 = __vmla<int8x16_t>;
+constexpr auto vmlaq_s16 = __vmla<int16x8_t>;
+constexpr auto vmlaq_s32 = __vmla<int32x4_t>;
 
-const auto &vmla_u8 = __vmla<uint8x8_t>;
-const auto &vmla_u16 = __vmla<uint16x4_t>;
-const auto &vmla_u32 = __vmla<uint32x2_t>;
+constexpr auto vmlaq_u8 = __vmla<uint8x16_t>;
+constexpr auto vmlaq_u16 = __vmla<uint16x8_t>;
+constexpr auto vmlaq_u32 = __vmla<uint32x4_t>;
+
+constexpr auto vmlaq_f32 = __vmla<float32x4_t>;
+
+template <typename T, typename R>
+IRIS_INLINE constexpr R __vmlal(R v1, T v2, T v3)
+{
+    return __vadd(v1, __vmull<T, R>(v2, v3));
+}
 
-const auto &vmla_f32 = __vmla<float32x2_t>;
+constexpr auto vmlal_s8 = __vmlal<int8x8_t, int16x8_t>;
+constexpr auto vmlal_s16 = __vmlal<int16x4_t, int32x4_t>;
+constexpr auto vmlal_s32 = __vmlal<int32x2_t, int64x2_t>;
 
-const auto &vmlaq_s8 = __vmla<int8x16_t>;
-const auto &vmlaq_s16 = __vmla<int16x8_t>;
-const auto &vmlaq_s32 = __vmla<int32x4_t>;
+constexpr auto vmlal_u8 = __vmlal<uint8x8_t, uint16x8_t>;
+constexpr auto vmlal_u16 = __vmlal<uint16x4_t, uint32x4_t>;
+constexpr auto vmlal_u32 = __vmlal<uint32x2_t, uint64x2_t>;
 
-const auto &vmlaq_u8 = __vmla<uint8x16_t>;
-const auto &vmlaq_u16 = __vmla<uint16x8_t>;
-const auto &vmlaq_u32 = __vmla<uint32x4_t>;
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vqdmlal(R v1, T v2, T v3)
+{
+    return __vqadd<R, B>(v1, __vqdmull<T, R, B>(v2, v3));
+}
 
-const auto &vmlaq_f32 = __vmla<float32x4_t>;
+template <typename T, typename R>
+IRIS_INLINE constexpr R __vqdmlal_n(R v1, T v2, typename T::elementType x)
+{
+    return __vqdmlal<T, R>(v1, v2, __vdup<T, typename T::elementType>(x));
+}
 
 template <typename T, typename R>
-R __vmlal(T v1, T v2, T v3)
+IRIS_INLINE constexpr R __vqdmlal_lane(R v1, T v2, T v3, int32_t lane)
 {
-    R result = __vmull<T, R>(v1, v2);
-    return __vaddw(result, v3);
+    return __vqdmlal_n<T, R>(v1, v2, __vget_lane<T, typename T::elementType>(v3, lane));
 }
 
-const auto &vmlal_s8 = __vmlal<int8x8_t, int16x8_t>;
-const auto &vmlal_s16 = __vmlal<int16x4_t, int32x4_t>;
-const auto &vmlal_s32 = __vmlal<int32x2_t, int64x2_t>;
+constexpr auto vqdmlal_s16 = __vqdmlal<int16x4_t, int32x4_t>;
+constexpr auto vqdmlal_s32 = __vqdmlal<int32x2_t, int64x2_t>;
 
-const auto &vmlal_u8 = __vmlal<uint8x8_t, uint16x8_t>;
-const auto &vmlal_u16 = __vmlal<uint16x4_t, uint32x4_t>;
-const auto &vmlal_u32 = __vmlal<uint32x2_t, uint64x2_t>;
+constexpr auto vqdmlal_n_s16 = __vqdmlal_n<int16x4_t, int32x4_t>;
+constexpr auto vqdmlal_n_s32 = __vqdmlal_n<int32x2_t, int64x2_t>;
+
+constexpr auto vqdmlal_lane_s16 = __vqdmlal_lane<int16x4_t, int32x4_t>;
+constexpr auto vqdmlal_lane_s32 = __vqdmlal_lane<int32x2_t, int64x2_t>;
 
 template <typename T>
-T __vmla_n(T v1, T v2, typename T::elementType x)
+IRIS_INLINE constexpr T __vmla_n(T v1, T v2, typename T::elementType x)
 {
     auto p = __vdup<T, typename T::elementType>(x);
     return __vadd(v1, __vmul(v2, p));
 }
 
-const auto &vmla_n_s16 = __vmla_n<int16x4_t>;
-const auto &vmla_n_s32 = __vmla_n<int32x2_t>;
+constexpr auto vmla_n_s16 = __vmla_n<int16x4_t>;
+constexpr auto vmla_n_s32 = __vmla_n<int32x2_t>;
 
-const auto &vmla_n_u16 = __vmla_n<uint16x4_t>;
-const auto &vmla_n_u32 = __vmla_n<uint32x2_t>;
+constexpr auto vmla_n_u16 = __vmla_n<uint16x4_t>;
+constexpr auto vmla_n_u32 = __vmla_n<uint32x2_t>;
 
-const auto &vmla_n_f32 = __vmla_n<float32x2_t>;
+constexpr auto vmla_n_f32 = __vmla_n<float32x2_t>;
 
-const auto &vmlaq_n_s16 = __vmla_n<int16x8_t>;
-const auto &vmlaq_n_s32 = __vmla_n<int32x4_t>;
+constexpr auto vmlaq_n_s16 = __vmla_n<int16x8_t>;
+constexpr auto vmlaq_n_s32 = __vmla_n<int32x4_t>;
 
-const auto &vmlaq_n_u16 = __vmla_n<uint16x8_t>;
-const auto &vmlaq_n_u32 = __vmla_n<uint32x4_t>;
+constexpr auto vmlaq_n_u16 = __vmla_n<uint16x8_t>;
+constexpr auto vmlaq_n_u32 = __vmla_n<uint32x4_t>;
 
-const auto &vmlaq_n_f32 = __vmla_n<float32x4_t>;
+constexpr auto vmlaq_n_f32 = __vmla_n<float32x4_t>;
 
 template <typename T>
-T __vmla_lane(T v1, T v2, T v3, int32_t x)
+IRIS_INLINE constexpr T __vmla_lane(T v1, T v2, T v3, int32_t x)
 {
     auto p = __vdup_lane<T, typename T::elementType>(v3, x);
     return __vadd(v1, __vmul(v2, p));
 }
 
-const auto &vmla_lane_s16 = __vmla_lane<int16x4_t>;
-const auto &vmla_lane_s32 = __vmla_lane<int32x2_t>;
+template <size_t n, typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vmla_lane(T v1, T v2, T v3)
+{
+    static_assert(n < T::length, "vmla_lane lane out of range");
+    return __vadd<T, B>(v1, __vmul<T, B>(v2, __vdup_lane<n, T, B>(v3)));
+}
+
+constexpr auto vmla_lane_s16 = __vmla_lane<int16x4_t>;
+constexpr auto vmla_lane_s32 = __vmla_lane<int32x2_t>;
 
-const auto &vmla_lane_u16 = __vmla_lane<uint16x4_t>;
-const auto &vmla_lane_u32 = __vmla_lane<uint32x2_t>;
+constexpr auto vmla_lane_u16 = __vmla_lane<uint16x4_t>;
+constexpr auto vmla_lane_u32 = __vmla_lane<uint32x2_t>;
 
-const auto &vmla_lane_f32 = __vmla_lane<float32x2_t>;
+constexpr auto vmla_lane_f32 = __vmla_lane<float32x2_t>;
 
-const auto &vmlaq_lane_s16 = __vmla_lane<int16x8_t>;
-const auto &vmlaq_lane_s32 = __vmla_lane<int32x4_t>;
+constexpr auto vmlaq_lane_s16 = __vmla_lane<int16x8_t>;
+constexpr auto vmlaq_lane_s32 = __vmla_lane<int32x4_t>;
 
-const auto &vmlaq_lane_u16 = __vmla_lane<uint16x8_t>;
-const auto &vmlaq_lane_u32 = __vmla_lane<uint32x4_t>;
+constexpr auto vmlaq_lane_u16 = __vmla_lane<uint16x8_t>;
+constexpr auto vmlaq_lane_u32 = __vmla_lane<uint32x4_t>;
 
-const auto &vmlaq_lane_f32 = __vmla_lane<float32x4_t>;
+constexpr auto vmlaq_lane_f32 = __vmla_lane<float32x4_t>;
+
+// Template-immediate forms, e.g. vmlaq_lane<2>(v1, v2, v3).
+template <size_t n, typename T>
+IRIS_INLINE constexpr T vmla_lane(T v1, T v2, T v3)
+{
+    static_assert(T::byteSize == 8, "vmla_lane takes 64-bit vectors");
+    return __vmla_lane<n, T>(v1, v2, v3);
+}
+
+// the lane comes from a 64-bit vector, as in NEON; laneq takes a 128-bit one
+template <size_t n, typename T, typename L>
+IRIS_INLINE constexpr T vmlaq_lane(T v1, T v2, L v3)
+{
+    static_assert(T::byteSize == 16 && L::byteSize == 8, "vmlaq_lane takes 128-bit vectors and a 64-bit lane vector");
+    static_assert(std::is_same<typename T::elementType, typename L::elementType>::value, "vmlaq_lane lane type mismatch");
+    static_assert(n < L::length, "vmlaq_lane lane out of range");
+    return __vmla_lane<n, T>(v1, v2, __vcombine<L, T>(v3, v3));
+}
+
+template <size_t n, typename T>
+IRIS_INLINE constexpr T vmlaq_laneq(T v1, T v2, T v3)
+{
+    static_assert(T::byteSize == 16, "vmlaq_laneq takes 128-bit vectors");
+    return __vmla_lane<n, T>(v1, v2, v3);
+}
 
 } // namespace iris::arm::multiplication_addition
 
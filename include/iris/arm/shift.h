@@ -1,4 +1,5 @@
 #include "common.h"
+#include "gnu/shift.h"
 
 #ifndef IRIS_ARM_SHIFT
 #define IRIS_ARM_SHIFT
@@ -7,162 +8,309 @@ namespace iris::arm::shift
 {
 
 template <typename T>
-T __vshl(T v1, T v2)
+IRIS_INLINE constexpr T __vshl(T v1, T v2)
 {
+    using E = typename T::elementType;
+    using W = iris::common::wrap_lane<E>;
+    constexpr W bits = sizeof(E) * 8;
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        typename T::elementType value = v1.template at<typename T::elementType>(i);
-        typename T::elementType shift = v2.template at<typename T::elementType>(i);
-        if (std::numeric_limits<typename T::elementType>::is_signed && shift < 0)
+        E value = v1.template at<E>(i);
+        E shift = v2.template at<E>(i);
+        // shifts of the lane width or more leave the sign (right) or zero
+        // (left); left shifts run on the unsigned lane
+        if (std::numeric_limits<E>::is_signed && shift < 0)
         {
-            result.template at<typename T::elementType>(i) = value >> -shift;
+            W amount = W(0) - static_cast<W>(shift);
+            result.template at<E>(i) = static_cast<E>(value >> (amount < bits ? amount : bits - 1));
         }
         else
         {
-            result.template at<typename T::elementType>(i) = value << shift;
+            result.template at<E>(i) = shift < E(bits) ? static_cast<E>(static_cast<W>(value) << shift) : E(0);
         }
     }
     return result;
 }
 
-template <typename T>
-T __vshl_n(T v, uint32_t shift)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vshl_n(T v, uint32_t shift)
 {
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>() && shift < sizeof(typename T::elementType) * 8)
+    {
+        return gnu::__vshl_n(v, shift);
+    }
+#endif
+    using E = typename T::elementType;
+    using W = iris::common::wrap_lane<E>;
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        typename T::elementType value = v.template at<typename T::elementType>(i);
-        result.template at<typename T::elementType>(i) = value << shift;
+        E value = v.template at<E>(i);
+        result.template at<E>(i) = shift < sizeof(E) * 8 ? static_cast<E>(static_cast<W>(value) << shift) : E(0);
     }
     return result;
 }
 
-template <typename T>
-T __vshr_n(T v, uint32_t shift)
+// shift as a template argument, 0 to lane bits - 1 as on NEON
+template <uint32_t n, typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vshl_n(T v)
+{
+    static_assert(n < sizeof(typename T::elementType) * 8, "vshl_n shift out of range");
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vshl_n<n>(v);
+    }
+#endif
+    return __vshl_n<T, backend::scalar>(v, n);
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vshr_n(T v, uint32_t shift)
 {
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>() && shift < sizeof(typename T::elementType) * 8)
+    {
+        return gnu::__vshr_n(v, shift);
+    }
+#endif
+    using E = typename T::elementType;
+    constexpr uint32_t bits = sizeof(E) * 8;
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        typename T::elementType value = v.template at<typename T::elementType>(i);
-        result.template at<typename T::elementType>(i) = value >> shift;
+        E value = v.template at<E>(i);
+        // shifts of the lane width or more leave the sign of signed lanes and
+        // zero in unsigned ones
+        if (shift < bits)
+        {
+            result.template at<E>(i) = static_cast<E>(value >> shift);
+        }
+        else
+        {
+            result.template at<E>(i) = std::is_signed<E>::value ? static_cast<E>(value >> (bits - 1)) : E(0);
+        }
     }
     return result;
 }
 
+// shift as a template argument, 1 to lane bits as on NEON; a full-width
+// shift leaves the sign of signed lanes and zero in unsigned ones
+template <uint32_t n, typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vshr_n(T v)
+{
+    using E = typename T::elementType;
+    constexpr uint32_t bits = sizeof(E) * 8;
+    static_assert(n >= 1 && n <= bits, "vshr_n shift out of range");
+    if constexpr (n == bits && std::is_signed<E>::value)
+    {
+        return __vshr_n<bits - 1, T, B>(v);
+    }
+    else if constexpr (n == bits)
+    {
+        return T();
+    }
+    else
+    {
+#if IRIS_ARM_GNU
+        if (gnu::__supports<B>())
+        {
+            return gnu::__vshr_n<n>(v);
+        }
+#endif
+        return __vshr_n<T, backend::scalar>(v, n);
+    }
+}
+
+// VRSHR: (x + 2^(n-1)) >> n with the addition at full precision, which is
+// the floor of x / 2^n plus the last bit shifted out; a shift of 0 keeps x
+template <typename E>
+IRIS_INLINE constexpr E __iris__rshr(E x, uint32_t n)
+{
+    constexpr uint32_t bits = sizeof(E) * 8;
+    if (n == 0)
+    {
+        return x;
+    }
+    E floor = 0;
+    if (n < bits)
+    {
+        floor = static_cast<E>(x >> n);
+    }
+    else if constexpr (std::is_signed<E>::value)
+    {
+        floor = static_cast<E>(x >> (bits - 1));
+    }
+    return static_cast<E>(floor + ((x >> (n - 1)) & 1));
+}
+
 template <typename T>
-T __vrshr_n(T v, uint32_t shift)
+IRIS_INLINE constexpr T __vrshr_n(T v, uint32_t shift)
 {
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        typename T::elementType value = v.template at<typename T::elementType>(i);
-        if (value % 2 != 0)
-        {
-            value = value + 1;
-        }
-        typename T::elementType part = value >> shift;
-        result.template at<typename T::elementType>(i) = part;
+        result.template at<typename T::elementType>(i) = __iris__rshr(v.template at<typename T::elementType>(i), shift);
     }
     return result;
 }
 
+// the same sum with both shifts immediate
+template <uint32_t n, typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vrshr_n(T v)
+{
+    using E = typename T::elementType;
+    static_assert(n >= 1 && n <= sizeof(E) * 8, "vrshr_n shift out of range");
+    T last = v;
+    if constexpr (n > 1)
+    {
+        last = __vshr_n<n - 1, T, B>(v);
+    }
+    return __vadd<T, B>(__vshr_n<n, T, B>(v), __vand<T, B>(last, __vdup<T, E>(1)));
+}
+
 // ARM NEON - vshl - 64-bit vectors ////////////////////////////////////
-const auto &vshl_u8 = __vshl<uint8x8_t>;
-const auto &vshl_u16 = __vshl<uint16x4_t>;
-const auto &vshl_u32 = __vshl<uint32x2_t>;
-const auto &vshl_u64 = __vshl<uint64x1_t>;
-
-const auto &vshl_s8 = __vshl<int8x8_t>;
-const auto &vshl_s16 = __vshl<int16x4_t>;
-const auto &vshl_s32 = __vshl<int32x2_t>;
-const auto &vshl_s64 = __vshl<int64x1_t>;
+constexpr auto vshl_u8 = __vshl<uint8x8_t>;
+constexpr auto vshl_u16 = __vshl<uint16x4_t>;
+constexpr auto vshl_u32 = __vshl<uint32x2_t>;
+constexpr auto vshl_u64 = __vshl<uint64x1_t>;
+
+constexpr auto vshl_s8 = __vshl<int8x8_t>;
+constexpr auto vshl_s16 = __vshl<int16x4_t>;
+constexpr auto vshl_s32 = __vshl<int32x2_t>;
+constexpr auto vshl_s64 = __vshl<int64x1_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshl - 128-bit vectors ////////////////////////////////////
-const auto &vshlq_u8 = __vshl<uint8x16_t>;
-const auto &vshlq_u16 = __vshl<uint16x8_t>;
-const auto &vshlq_u32 = __vshl<uint32x4_t>;
-const auto &vshlq_u64 = __vshl<uint64x2_t>;
-
-const auto &vshlq_s8 = __vshl<int8x16_t>;
-const auto &vshlq_s16 = __vshl<int16x8_t>;
-const auto &vshlq_s32 = __vshl<int32x4_t>;
-const auto &vshlq_s64 = __vshl<int64x2_t>;
+constexpr auto vshlq_u8 = __vshl<uint8x16_t>;
+constexpr auto vshlq_u16 = __vshl<uint16x8_t>;
+constexpr auto vshlq_u32 = __vshl<uint32x4_t>;
+constexpr auto vshlq_u64 = __vshl<uint64x2_t>;
+
+constexpr auto vshlq_s8 = __vshl<int8x16_t>;
+constexpr auto vshlq_s16 = __vshl<int16x8_t>;
+constexpr auto vshlq_s32 = __vshl<int32x4_t>;
+constexpr auto vshlq_s64 = __vshl<int64x2_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshl_n - 64-bit vectors ////////////////////////////////////
-const auto &vshl_n_u8 = __vshl_n<uint8x8_t>;
-const auto &vshl_n_u16 = __vshl_n<uint16x4_t>;
-const auto &vshl_n_u32 = __vshl_n<uint32x2_t>;
-const auto &vshl_n_u64 = __vshl_n<uint64x1_t>;
-
-const auto &vshl_n_s8 = __vshl_n<int8x8_t>;
-const auto &vshl_n_s16 = __vshl_n<int16x4_t>;
-const auto &vshl_n_s32 = __vshl_n<int32x2_t>;
-const auto &vshl_n_s64 = __vshl_n<int64x1_t>;
+constexpr auto vshl_n_u8 = __vshl_n<uint8x8_t>;
+constexpr auto vshl_n_u16 = __vshl_n<uint16x4_t>;
+constexpr auto vshl_n_u32 = __vshl_n<uint32x2_t>;
+constexpr auto vshl_n_u64 = __vshl_n<uint64x1_t>;
+
+constexpr auto vshl_n_s8 = __vshl_n<int8x8_t>;
+constexpr auto vshl_n_s16 = __vshl_n<int16x4_t>;
+constexpr auto vshl_n_s32 = __vshl_n<int32x2_t>;
+constexpr auto vshl_n_s64 = __vshl_n<int64x1_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshl - 128-bit vectors ////////////////////////////////////
-const auto &vshlq_n_u8 = __vshl_n<uint8x16_t>;
-const auto &vshlq_n_u16 = __vshl_n<uint16x8_t>;
-const auto &vshlq_n_u32 = __vshl_n<uint32x4_t>;
-const auto &vshlq_n_u64 = __vshl_n<uint64x2_t>;
-
-const auto &vshlq_n_s8 = __vshl_n<int8x16_t>;
-const auto &vshlq_n_s16 = __vshl_n<int16x8_t>;
-const auto &vshlq_n_s32 = __vshl_n<int32x4_t>;
-const auto &vshlq_n_s64 = __vshl_n<int64x2_t>;
+constexpr auto vshlq_n_u8 = __vshl_n<uint8x16_t>;
+constexpr auto vshlq_n_u16 = __vshl_n<uint16x8_t>;
+constexpr auto vshlq_n_u32 = __vshl_n<uint32x4_t>;
+constexpr auto vshlq_n_u64 = __vshl_n<uint64x2_t>;
+
+constexpr auto vshlq_n_s8 = __vshl_n<int8x16_t>;
+constexpr auto vshlq_n_s16 = __vshl_n<int16x8_t>;
+constexpr auto vshlq_n_s32 = __vshl_n<int32x4_t>;
+constexpr auto vshlq_n_s64 = __vshl_n<int64x2_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshr_n - 64-bit vectors ////////////////////////////////////
-const auto &vshr_n_u8 = __vshr_n<uint8x8_t>;
-const auto &vshr_n_u16 = __vshr_n<uint16x4_t>;
-const auto &vshr_n_u32 = __vshr_n<uint32x2_t>;
-const auto &vshr_n_u64 = __vshr_n<uint64x1_t>;
-
-const auto &vshr_n_s8 = __vshr_n<int8x8_t>;
-const auto &vshr_n_s16 = __vshr_n<int16x4_t>;
-const auto &vshr_n_s32 = __vshr_n<int32x2_t>;
-const auto &vshr_n_s64 = __vshr_n<int64x1_t>;
+constexpr auto vshr_n_u8 = __vshr_n<uint8x8_t>;
+constexpr auto vshr_n_u16 = __vshr_n<uint16x4_t>;
+constexpr auto vshr_n_u32 = __vshr_n<uint32x2_t>;
+constexpr auto vshr_n_u64 = __vshr_n<uint64x1_t>;
+
+constexpr auto vshr_n_s8 = __vshr_n<int8x8_t>;
+constexpr auto vshr_n_s16 = __vshr_n<int16x4_t>;
+constexpr auto vshr_n_s32 = __vshr_n<int32x2_t>;
+constexpr auto vshr_n_s64 = __vshr_n<int64x1_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshr - 128-bit vectors ////////////////////////////////////
-const auto &vshrq_n_u8 = __vshr_n<uint8x16_t>;
-const auto &vshrq_n_u16 = __vshr_n<uint16x8_t>;
-const auto &vshrq_n_u32 = __vshr_n<uint32x4_t>;
-const auto &vshrq_n_u64 = __vshr_n<uint64x2_t>;
-
-const auto &vshrq_n_s8 = __vshr_n<int8x16_t>;
-const auto &vshrq_n_s16 = __vshr_n<int16x8_t>;
-const auto &vshrq_n_s32 = __vshr_n<int32x4_t>;
-const auto &vshrq_n_s64 = __vshr_n<int64x2_t>;
+constexpr auto vshrq_n_u8 = __vshr_n<uint8x16_t>;
+constexpr auto vshrq_n_u16 = __vshr_n<uint16x8_t>;
+constexpr auto vshrq_n_u32 = __vshr_n<uint32x4_t>;
+constexpr auto vshrq_n_u64 = __vshr_n<uint64x2_t>;
+
+constexpr auto vshrq_n_s8 = __vshr_n<int8x16_t>;
+constexpr auto vshrq_n_s16 = __vshr_n<int16x8_t>;
+constexpr auto vshrq_n_s32 = __vshr_n<int32x4_t>;
+constexpr auto vshrq_n_s64 = __vshr_n<int64x2_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshr_n - 64-bit vectors ////////////////////////////////////
-const auto &vrshr_n_u8 = __vrshr_n<uint8x8_t>;
-const auto &vrshr_n_u16 = __vrshr_n<uint16x4_t>;
-const auto &vrshr_n_u32 = __vrshr_n<uint32x2_t>;
-const auto &vrshr_n_u64 = __vrshr_n<uint64x1_t>;
-
-const auto &vrshr_n_s8 = __vrshr_n<int8x8_t>;
-const auto &vrshr_n_s16 = __vrshr_n<int16x4_t>;
-const auto &vrshr_n_s32 = __vrshr_n<int32x2_t>;
-const auto &vrshr_n_s64 = __vrshr_n<int64x1_t>;
+constexpr auto vrshr_n_u8 = __vrshr_n<uint8x8_t>;
+constexpr auto vrshr_n_u16 = __vrshr_n<uint16x4_t>;
+constexpr auto vrshr_n_u32 = __vrshr_n<uint32x2_t>;
+constexpr auto vrshr_n_u64 = __vrshr_n<uint64x1_t>;
+
+constexpr auto vrshr_n_s8 = __vrshr_n<int8x8_t>;
+constexpr auto vrshr_n_s16 = __vrshr_n<int16x4_t>;
+constexpr auto vrshr_n_s32 = __vrshr_n<int32x2_t>;
+constexpr auto vrshr_n_s64 = __vrshr_n<int64x1_t>;
 ////////////////////////////////////////////////////////////////////////
 
 // ARM NEON - vshr - 128-bit vectors ////////////////////////////////////
-const auto &vrshrq_n_u8 = __vrshr_n<uint8x16_t>;
-const auto &vrshrq_n_u16 = __vrshr_n<uint16x8_t>;
-const auto &vrshrq_n_u32 = __vrshr_n<uint32x4_t>;
-const auto &vrshrq_n_u64 = __vrshr_n<uint64x2_t>;
-
-const auto &vrshrq_n_s8 = __vrshr_n<int8x16_t>;
-const auto &vrshrq_n_s16 = __vrshr_n<int16x8_t>;
-const auto &vrshrq_n_s32 = __vrshr_n<int32x4_t>;
-const auto &vrshrq_n_s64 = __vrshr_n<int64x2_t>;
+constexpr auto vrshrq_n_u8 = __vrshr_n<uint8x16_t>;
+constexpr auto vrshrq_n_u16 = __vrshr_n<uint16x8_t>;
+constexpr auto vrshrq_n_u32 = __vrshr_n<uint32x4_t>;
+constexpr auto vrshrq_n_u64 = __vrshr_n<uint64x2_t>;
+
+constexpr auto vrshrq_n_s8 = __vrshr_n<int8x16_t>;
+constexpr auto vrshrq_n_s16 = __vrshr_n<int16x8_t>;
+constexpr auto vrshrq_n_s32 = __vrshr_n<int32x4_t>;
+constexpr auto vrshrq_n_s64 = __vrshr_n<int64x2_t>;
 ////////////////////////////////////////////////////////////////////////
 
+// Template-immediate forms, e.g. vshrq_n<3>(v): the shift is checked at
+// compile time and each count becomes a single constant shift.
+template <uint32_t n, typename T>
+IRIS_INLINE constexpr T vshl_n(T v)
+{
+    static_assert(T::byteSize == 8, "vshl_n takes a 64-bit vector");
+    return __vshl_n<n, T>(v);
+}
+
+template <uint32_t n, typename T>
+IRIS_INLINE constexpr T vshlq_n(T v)
+{
+    static_assert(T::byteSize == 16, "vshlq_n takes a 128-bit vector");
+    return __vshl_n<n, T>(v);
+}
+
+template <uint32_t n, typename T>
+IRIS_INLINE constexpr T vshr_n(T v)
+{
+    static_assert(T::byteSize == 8, "vshr_n takes a 64-bit vector");
+    return __vshr_n<n, T>(v);
+}
+
+template <uint32_t n, typename T>
+IRIS_INLINE constexpr T vshrq_n(T v)
+{
+    static_assert(T::byteSize == 16, "vshrq_n takes a 128-bit vector");
+    return __vshr_n<n, T>(v);
+}
+
+template <uint32_t n, typename T>
+IRIS_INLINE constexpr T vrshr_n(T v)
+{
+    static_assert(T::byteSize == 8, "vrshr_n takes a 64-bit vector");
+    return __vrshr_n<n, T>(v);
+}
+
+template <uint32_t n, typename T>
+IRIS_INLINE constexpr T vrshrq_n(T v)
+{
+    static_assert(T::byteSize == 16, "vrshrq_n takes a 128-bit vector");
+    return __vrshr_n<n, T>(v);
+}
+
 } // namespace iris::arm::shift
 
 using namespace iris::arm::shift;
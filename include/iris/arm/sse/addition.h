@@ -0,0 +1,313 @@
+#include "common.h"
+#include <limits>
+
+#ifndef IRIS_ARM_SSE_ADDITION
+#define IRIS_ARM_SSE_ADDITION
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vadd(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return __store<T>(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))));
+    }
+    else
+    {
+        return __store<T>(__add<E>(a, b));
+    }
+}
+
+// floor((a + b) / 2) on unsigned lanes, without the intermediate overflow
+template <typename E>
+IRIS_FORCE_INLINE __m128i __avg_floor_unsigned(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_sub_epi16(_mm_avg_epu16(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi16(1)));
+    }
+    else
+    {
+        return _mm_add_epi32(_mm_and_si128(a, b), _mm_srli_epi32(_mm_xor_si128(a, b), 1));
+    }
+}
+
+// floor((a + b + 1) / 2) on unsigned lanes, without the intermediate overflow
+template <typename E>
+IRIS_FORCE_INLINE __m128i __avg_round_unsigned(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_avg_epu8(a, b);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_avg_epu16(a, b);
+    }
+    else
+    {
+        return _mm_sub_epi32(_mm_or_si128(a, b), _mm_srli_epi32(_mm_xor_si128(a, b), 1));
+    }
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vhadd(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (std::is_signed<E>::value)
+    {
+        __m128i bias = __sign_bias<E>();
+        __m128i x = __avg_floor_unsigned<E>(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+        return __store<T>(_mm_xor_si128(x, bias));
+    }
+    else
+    {
+        return __store<T>(__avg_floor_unsigned<E>(a, b));
+    }
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vrhadd(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (std::is_signed<E>::value)
+    {
+        __m128i bias = __sign_bias<E>();
+        __m128i x = __avg_round_unsigned<E>(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+        return __store<T>(_mm_xor_si128(x, bias));
+    }
+    else
+    {
+        return __store<T>(__avg_round_unsigned<E>(a, b));
+    }
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vqadd(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (sizeof(E) == 1)
+    {
+        return __store<T>(std::is_signed<E>::value ? _mm_adds_epi8(a, b) : _mm_adds_epu8(a, b));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return __store<T>(std::is_signed<E>::value ? _mm_adds_epi16(a, b) : _mm_adds_epu16(a, b));
+    }
+    else
+    {
+        __m128i sum = sizeof(E) == 4 ? _mm_add_epi32(a, b) : _mm_add_epi64(a, b);
+        if constexpr (std::is_signed<E>::value)
+        {
+            // Overflow when both operands share a sign the sum does not have.
+            __m128i overflow = __sign_mask<E>(_mm_and_si128(_mm_xor_si128(sum, a), _mm_xor_si128(sum, b)));
+            __m128i saturated = _mm_xor_si128(__sign_mask<E>(a), __set1_max<E>());
+            return __store<T>(__select(overflow, saturated, sum));
+        }
+        else
+        {
+            __m128i carry = _mm_or_si128(_mm_and_si128(a, b), _mm_andnot_si128(sum, _mm_or_si128(a, b)));
+            return __store<T>(_mm_or_si128(sum, __sign_mask<E>(carry)));
+        }
+    }
+}
+
+template <typename T, typename R, typename B>
+IRIS_FORCE_INLINE R __vaddl(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__add<typename R::elementType>(__widen<E, B>(__load(v1)), __widen<E, B>(__load(v2))));
+}
+
+template <typename R, typename T, typename B>
+IRIS_FORCE_INLINE R __vaddw(R v1, T v2)
+{
+    return __store<R>(__add<typename R::elementType>(__load(v1), __widen<typename T::elementType, B>(__load(v2))));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vaddhn(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__narrow_high<E>(__add<E>(__load(v1), __load(v2))));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vraddhn(T v1, T v2)
+{
+    using E = typename T::elementType;
+    using U = typename std::make_unsigned<E>::type;
+    __m128i sum = __add<E>(__load(v1), __load(v2));
+    sum = __add<E>(sum, __set1<U>(static_cast<U>(U(1) << (sizeof(E) * 4 - 1))));
+    return __store<R>(__narrow_high<E>(sum));
+}
+
+#if IRIS_ARM_SSSE3
+template <typename E>
+IRIS_ARM_TARGET("ssse3")
+__m128i __hadd_ssse3(__m128i a, __m128i b)
+{
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return _mm_castps_si128(_mm_hadd_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_hadd_epi16(a, b);
+    }
+    else
+    {
+        return _mm_hadd_epi32(a, b);
+    }
+}
+
+IRIS_ARM_TARGET("ssse3")
+__m128i __maddubs(__m128i a, __m128i b)
+{
+    return _mm_maddubs_epi16(a, b);
+}
+#endif
+
+// Sums of adjacent lane pairs, those of a in the lower half and those of b
+// in the upper one.
+template <typename E, typename B>
+IRIS_FORCE_INLINE __m128i __hadd(__m128i a, __m128i b)
+{
+#if IRIS_ARM_SSSE3
+    if constexpr (sizeof(E) == 2 || sizeof(E) == 4)
+    {
+        if (__supports<B>(tier::ssse3))
+        {
+            return __hadd_ssse3<E>(a, b);
+        }
+    }
+#endif
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        __m128 x = _mm_castsi128_ps(a);
+        __m128 y = _mm_castsi128_ps(b);
+        return _mm_castps_si128(_mm_add_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1))));
+    }
+    else if constexpr (sizeof(E) == 1)
+    {
+        // pair sums in the low byte of every 16-bit lane
+        __m128i low = _mm_set1_epi16(0xff);
+        __m128i x = _mm_and_si128(_mm_add_epi8(a, _mm_srli_epi16(a, 8)), low);
+        __m128i y = _mm_and_si128(_mm_add_epi8(b, _mm_srli_epi16(b, 8)), low);
+        return _mm_packus_epi16(x, y);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        // pair sums in the low half of every 32-bit lane, sign extended so
+        // that packssdw keeps them
+        __m128i x = _mm_srai_epi32(_mm_slli_epi32(_mm_add_epi16(a, _mm_srli_epi32(a, 16)), 16), 16);
+        __m128i y = _mm_srai_epi32(_mm_slli_epi32(_mm_add_epi16(b, _mm_srli_epi32(b, 16)), 16), 16);
+        return _mm_packs_epi32(x, y);
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        __m128 x = _mm_castsi128_ps(a);
+        __m128 y = _mm_castsi128_ps(b);
+        __m128i even = _mm_castps_si128(_mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i odd = _mm_castps_si128(_mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1)));
+        return _mm_add_epi32(even, odd);
+    }
+    else
+    {
+        return _mm_add_epi64(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+    }
+}
+
+// 64-bit vectors are paired up in one register first
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vpadd(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (T::byteSize == 8)
+    {
+        a = _mm_unpacklo_epi64(a, b);
+        b = a;
+    }
+    return __store<T>(__hadd<E, B>(a, b));
+}
+
+// Sums of adjacent lane pairs in twice the width: pmaddubsw and pmaddwd
+// against a vector of ones for 8 and 16-bit lanes.
+template <typename E, typename B>
+IRIS_FORCE_INLINE __m128i __hadd_wide(__m128i x)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+#if IRIS_ARM_SSSE3
+        if (__supports<B>(tier::ssse3))
+        {
+            // unsigned bytes of the first operand times signed bytes of the second
+            __m128i ones = _mm_set1_epi8(1);
+            return std::is_signed<E>::value ? __maddubs(ones, x) : __maddubs(x, ones);
+        }
+#endif
+        if constexpr (std::is_signed<E>::value)
+        {
+            return _mm_add_epi16(_mm_srai_epi16(_mm_slli_epi16(x, 8), 8), _mm_srai_epi16(x, 8));
+        }
+        else
+        {
+            return _mm_add_epi16(_mm_and_si128(x, _mm_set1_epi16(0xff)), _mm_srli_epi16(x, 8));
+        }
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        if constexpr (std::is_signed<E>::value)
+        {
+            return _mm_madd_epi16(x, _mm_set1_epi16(1));
+        }
+        else
+        {
+            // pmaddwd is signed: both lanes biased by -0x8000, 0x10000 added back
+            __m128i biased = _mm_xor_si128(x, _mm_set1_epi16(static_cast<short>(0x8000)));
+            return _mm_add_epi32(_mm_madd_epi16(biased, _mm_set1_epi16(1)), _mm_set1_epi32(0x10000));
+        }
+    }
+    else
+    {
+        __m128i low = _mm_set_epi32(0, -1, 0, -1);
+        __m128i even = _mm_and_si128(x, low);
+        __m128i odd = _mm_srli_epi64(x, 32);
+        if constexpr (std::is_signed<E>::value)
+        {
+            __m128i sign = _mm_srai_epi32(x, 31);
+            even = _mm_or_si128(even, _mm_slli_epi64(sign, 32));
+            odd = _mm_or_si128(odd, _mm_andnot_si128(low, sign));
+        }
+        return _mm_add_epi64(even, odd);
+    }
+}
+
+template <typename T, typename R, typename B>
+IRIS_FORCE_INLINE R __vpaddl(T v)
+{
+    return __store<R>(__hadd_wide<typename T::elementType, B>(__load(v)));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
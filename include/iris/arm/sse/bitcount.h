@@ -0,0 +1,125 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_SSE_BITCOUNT
+#define IRIS_ARM_SSE_BITCOUNT
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+#if IRIS_ARM_SSSE3
+// Looks both nibbles of every byte up in a 16-entry table.
+IRIS_ARM_TARGET("ssse3")
+void __nibble_lookup(__m128i table, __m128i x, __m128i &low, __m128i &high)
+{
+    __m128i mask = _mm_set1_epi8(0x0f);
+    low = _mm_shuffle_epi8(table, _mm_and_si128(x, mask));
+    high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+}
+#endif
+
+// bits set in every byte
+template <typename B>
+IRIS_FORCE_INLINE __m128i __popcount8(__m128i x)
+{
+#if IRIS_ARM_SSSE3
+    if (__supports<B>(tier::ssse3))
+    {
+        __m128i low, high;
+        __nibble_lookup(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4), x, low, high);
+        return _mm_add_epi8(low, high);
+    }
+#endif
+    x = _mm_sub_epi8(x, _mm_and_si128(_mm_srli_epi16(x, 1), _mm_set1_epi8(0x55)));
+    x = _mm_add_epi8(_mm_and_si128(x, _mm_set1_epi8(0x33)), _mm_and_si128(_mm_srli_epi16(x, 2), _mm_set1_epi8(0x33)));
+    return _mm_and_si128(_mm_add_epi8(x, _mm_srli_epi16(x, 4)), _mm_set1_epi8(0x0f));
+}
+
+// Leading zeros of every 32-bit lane from the exponent of its float value.
+// Clearing the bit below the leading one keeps the conversion from rounding
+// up to the next power of two; lanes with the top bit set are 0 and zero
+// lanes, whose exponent is 0, are clamped to 32.
+IRIS_FORCE_INLINE __m128i __clz32(__m128i x)
+{
+    __m128i lead = _mm_andnot_si128(_mm_srli_epi32(x, 1), x);
+    __m128i exponent = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(lead)), 23);
+    __m128i count = _mm_sub_epi32(_mm_set1_epi32(158), exponent);
+    // the counts fit in the low 16 bits, so pminsw clamps the 32-bit lanes
+    count = _mm_min_epi16(count, _mm_set1_epi32(32));
+    return _mm_andnot_si128(_mm_srai_epi32(x, 31), count);
+}
+
+template <typename E, typename B>
+IRIS_FORCE_INLINE __m128i __clz(__m128i x)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+#if IRIS_ARM_SSSE3
+        if (__supports<B>(tier::ssse3))
+        {
+            // leading zeros of the high nibble, plus those of the low one when it is 0
+            __m128i low, high;
+            __nibble_lookup(_mm_setr_epi8(4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0), x, low, high);
+            __m128i empty = _mm_cmpeq_epi8(high, _mm_set1_epi8(4));
+            return _mm_add_epi8(high, _mm_and_si128(empty, low));
+        }
+#endif
+        // 8 minus the bits set once the leading one is smeared to the right
+        x = _mm_or_si128(x, _mm_and_si128(_mm_srli_epi16(x, 1), _mm_set1_epi8(0x7f)));
+        x = _mm_or_si128(x, _mm_and_si128(_mm_srli_epi16(x, 2), _mm_set1_epi8(0x3f)));
+        x = _mm_or_si128(x, _mm_and_si128(_mm_srli_epi16(x, 4), _mm_set1_epi8(0x0f)));
+        return _mm_sub_epi8(_mm_set1_epi8(8), __popcount8<B>(x));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        // zero extended to 32 bits, the counts are 16 too many
+        __m128i zero = _mm_setzero_si128();
+        __m128i first = __clz32(_mm_unpacklo_epi16(x, zero));
+        __m128i second = __clz32(_mm_unpackhi_epi16(x, zero));
+        return _mm_sub_epi16(_mm_packs_epi32(first, second), _mm_set1_epi16(16));
+    }
+    else
+    {
+        return __clz32(x);
+    }
+}
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vcnt(T v)
+{
+    return __store<T>(__popcount8<B>(__load(v)));
+}
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vclz(T v)
+{
+    return __store<T>(__clz<typename T::elementType, B>(__load(v)));
+}
+
+// leading sign bits: the leading zeros after flipping negative lanes, minus
+// the sign bit itself
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vcls(T v)
+{
+    using E = typename T::elementType;
+    __m128i x = __load(v);
+    __m128i sign;
+    if constexpr (sizeof(E) == 1)
+    {
+        sign = _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        sign = _mm_srai_epi16(x, 15);
+    }
+    else
+    {
+        sign = _mm_srai_epi32(x, 31);
+    }
+    return __store<T>(__sub<E>(__clz<E, B>(_mm_xor_si128(x, sign)), __set1<E>(1)));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
@@ -0,0 +1,340 @@
+#include "../common.h"
+
+#ifndef IRIS_ARM_SSE_COMMON
+#define IRIS_ARM_SSE_COMMON
+
+// SSE2 lowering of the NEON families is enabled on every x86 host with SSE2.
+// Define IRIS_ARM_SCALAR to force the portable per-lane reference templates.
+#if !defined(IRIS_ARM_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IRIS_ARM_SSE2 1
+#include <emmintrin.h>
+#else
+#define IRIS_ARM_SSE2 0
+#endif
+
+// Define IRIS_ARM_DISPATCH to compile every kernel tier into the binary and
+// pick one at startup from CPUID instead of from the -m flags. The
+// IRIS_ARM_TIER environment variable (scalar, sse2, ssse3, sse4.1, avx2)
+// lowers the chosen tier, e.g. for A/B measurements.
+// Kernels built for a higher tier stay out of line there, as target clones
+// the dispatcher calls; otherwise they are inlined like every other kernel.
+#if IRIS_ARM_SSE2 && defined(IRIS_ARM_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+#define IRIS_ARM_RUNTIME 1
+#define IRIS_ARM_TARGET(isa) __attribute__((target(isa))) inline
+#include <cstdlib>
+#include <cstring>
+#include <immintrin.h>
+#else
+#define IRIS_ARM_RUNTIME 0
+#define IRIS_ARM_TARGET(isa) IRIS_FORCE_INLINE
+#endif
+
+// SSSE3 and SSE4.1 are only used where they replace a multi-instruction SSE2
+// sequence (pshufb/palignr permutes, pmovsx/pmovzx widening, pmuldq); every
+// kernel keeps an SSE2 fallback.
+#if IRIS_ARM_SSE2 && (defined(__SSSE3__) || IRIS_ARM_RUNTIME)
+#define IRIS_ARM_SSSE3 1
+#include <tmmintrin.h>
+#else
+#define IRIS_ARM_SSSE3 0
+#endif
+
+#if IRIS_ARM_SSE2 && (defined(__SSE4_1__) || IRIS_ARM_RUNTIME)
+#define IRIS_ARM_SSE41 1
+#include <smmintrin.h>
+#else
+#define IRIS_ARM_SSE41 0
+#endif
+
+// AVX2 is only used for gathers; the avx2 tier also requires FMA3.
+#if IRIS_ARM_SSE2 && (defined(__AVX2__) || IRIS_ARM_RUNTIME)
+#define IRIS_ARM_AVX2 1
+#include <immintrin.h>
+#else
+#define IRIS_ARM_AVX2 0
+#endif
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+using backend::tier;
+
+#if IRIS_ARM_RUNTIME
+inline tier __probe()
+{
+    __builtin_cpu_init();
+    tier host = tier::sse2;
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        host = tier::ssse3;
+        if (__builtin_cpu_supports("sse4.1"))
+        {
+            host = tier::sse41;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            {
+                host = tier::avx2;
+            }
+        }
+    }
+    const char *name = std::getenv("IRIS_ARM_TIER");
+    if (name == nullptr)
+    {
+        return host;
+    }
+    const char *names[] = {"scalar", "sse2", "ssse3", "sse4.1", "avx2"};
+    for (int i = 0; i < 5; i++)
+    {
+        if (std::strcmp(name, names[i]) == 0)
+        {
+            return static_cast<tier>(i) < host ? static_cast<tier>(i) : host;
+        }
+    }
+    return host;
+}
+
+// Probed on first use rather than by a dynamic initialiser, so intrinsics
+// called while other translation units are being initialised see the host
+// tier too instead of a still zero (scalar) one.
+inline tier __active_tier()
+{
+    static const tier active = __probe();
+    return active;
+}
+
+// Whether backend B may take the kernels of tier t on this host; never while
+// evaluating a constant expression.
+template <typename B>
+IRIS_FORCE_INLINE constexpr bool __supports(tier t)
+{
+    return !IRIS_CONSTANT_EVALUATED() && t <= B::limit && __active_tier() >= t;
+}
+#else
+// Without runtime dispatch every compiled-in kernel may be used.
+template <typename B>
+IRIS_FORCE_INLINE constexpr bool __supports(tier t)
+{
+    return !IRIS_CONSTANT_EVALUATED() && t <= B::limit;
+}
+#endif
+
+template <typename T>
+IRIS_FORCE_INLINE __m128i __load(const T &v)
+{
+#ifdef IRIS_SSE_STORAGE
+    return v.value_m128i;
+#else
+    if constexpr (T::byteSize == 16)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(&v.value));
+    }
+    else
+    {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&v.value));
+    }
+#endif
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __store(__m128i x)
+{
+    T result;
+#ifdef IRIS_SSE_STORAGE
+    result.value_m128i = x;
+#else
+    if constexpr (T::byteSize == 16)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&result.value), x);
+    }
+    else
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&result.value), x);
+    }
+#endif
+    return result;
+}
+
+template <typename E>
+IRIS_FORCE_INLINE __m128i __set1(E x)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_set1_epi8(static_cast<char>(x));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_set1_epi16(static_cast<short>(x));
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        return _mm_set1_epi32(static_cast<int>(x));
+    }
+    else
+    {
+        return _mm_set1_epi64x(static_cast<long long>(x));
+    }
+}
+
+// The limits are folded into constants, so -O0 builds do not call
+// numeric_limits for them.
+template <typename E>
+IRIS_FORCE_INLINE __m128i __set1_max()
+{
+    constexpr E x = std::numeric_limits<E>::max();
+    return __set1<E>(x);
+}
+
+template <typename E>
+IRIS_FORCE_INLINE __m128i __set1_min()
+{
+    constexpr E x = std::numeric_limits<E>::min();
+    return __set1<E>(x);
+}
+
+// Sign bit of every E lane; xor with it maps signed lanes onto unsigned order.
+template <typename E>
+IRIS_FORCE_INLINE __m128i __sign_bias()
+{
+    using U = typename std::make_unsigned<E>::type;
+    return __set1<U>(static_cast<U>(U(1) << (sizeof(E) * 8 - 1)));
+}
+
+// Broadcasts the top bit of every E lane across the lane.
+template <typename E>
+IRIS_FORCE_INLINE __m128i __sign_mask(__m128i x)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_srai_epi16(x, 15);
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        return _mm_srai_epi32(x, 31);
+    }
+    else
+    {
+        return _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1));
+    }
+}
+
+template <typename E>
+IRIS_FORCE_INLINE __m128i __add(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_add_epi8(a, b);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_add_epi16(a, b);
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        return _mm_add_epi32(a, b);
+    }
+    else
+    {
+        return _mm_add_epi64(a, b);
+    }
+}
+
+template <typename E>
+IRIS_FORCE_INLINE __m128i __sub(__m128i a, __m128i b)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_sub_epi8(a, b);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_sub_epi16(a, b);
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        return _mm_sub_epi32(a, b);
+    }
+    else
+    {
+        return _mm_sub_epi64(a, b);
+    }
+}
+
+// Sign or zero extends the low 64 bits of E lanes to lanes twice as wide.
+#if IRIS_ARM_SSE41
+template <typename E>
+IRIS_ARM_TARGET("sse4.1")
+__m128i __widen_sse41(__m128i x)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        return std::is_signed<E>::value ? _mm_cvtepi8_epi16(x) : _mm_cvtepu8_epi16(x);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return std::is_signed<E>::value ? _mm_cvtepi16_epi32(x) : _mm_cvtepu16_epi32(x);
+    }
+    else
+    {
+        return std::is_signed<E>::value ? _mm_cvtepi32_epi64(x) : _mm_cvtepu32_epi64(x);
+    }
+}
+#endif
+
+template <typename E, typename B>
+IRIS_FORCE_INLINE __m128i __widen(__m128i x)
+{
+#if IRIS_ARM_SSE41
+    if (__supports<B>(tier::sse41))
+    {
+        return __widen_sse41<E>(x);
+    }
+#endif
+    __m128i high = std::is_signed<E>::value ? __sign_mask<E>(x) : _mm_setzero_si128();
+    if constexpr (sizeof(E) == 1)
+    {
+        return _mm_unpacklo_epi8(x, high);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_unpacklo_epi16(x, high);
+    }
+    else
+    {
+        return _mm_unpacklo_epi32(x, high);
+    }
+}
+
+// Packs the upper half of every E lane into the low 64 bits.
+template <typename E>
+IRIS_FORCE_INLINE __m128i __narrow_high(__m128i x)
+{
+    if constexpr (sizeof(E) == 2)
+    {
+        x = _mm_srli_epi16(x, 8);
+        return _mm_packus_epi16(x, x);
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        x = _mm_srai_epi32(x, 16);
+        return _mm_packs_epi32(x, x);
+    }
+    else
+    {
+        return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+}
+
+// mask ? a : b, bitwise
+IRIS_FORCE_INLINE __m128i __select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
@@ -0,0 +1,146 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_SSE_COMPARISON
+#define IRIS_ARM_SSE_COMPARISON
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+template <typename E>
+IRIS_FORCE_INLINE __m128i __cmpeq(__m128i a, __m128i b)
+{
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+    else if constexpr (sizeof(E) == 1)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+    else
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+}
+
+// a > b; unsigned lanes are biased by the sign bit so the signed pcmpgt orders them
+template <typename E>
+IRIS_FORCE_INLINE __m128i __cmpgt(__m128i a, __m128i b)
+{
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return _mm_castps_si128(_mm_cmpgt_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+    else
+    {
+        if constexpr (!std::is_signed<E>::value)
+        {
+            a = _mm_xor_si128(a, __sign_bias<E>());
+            b = _mm_xor_si128(b, __sign_bias<E>());
+        }
+        if constexpr (sizeof(E) == 1)
+        {
+            return _mm_cmpgt_epi8(a, b);
+        }
+        else if constexpr (sizeof(E) == 2)
+        {
+            return _mm_cmpgt_epi16(a, b);
+        }
+        else
+        {
+            return _mm_cmpgt_epi32(a, b);
+        }
+    }
+}
+
+// a >= b; cmpps keeps NaN lanes false, integers invert b > a
+template <typename E>
+IRIS_FORCE_INLINE __m128i __cmpge(__m128i a, __m128i b)
+{
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return _mm_castps_si128(_mm_cmpge_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+    else
+    {
+        return _mm_xor_si128(__cmpgt<E>(b, a), _mm_set1_epi32(-1));
+    }
+}
+
+// |x| for float lanes
+IRIS_FORCE_INLINE __m128i __abs_ps(__m128i x)
+{
+    return _mm_and_si128(x, _mm_set1_epi32(0x7FFFFFFF));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vtst(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i zero = __cmpeq<E>(_mm_and_si128(__load(v1), __load(v2)), _mm_setzero_si128());
+    return __store<R>(_mm_xor_si128(zero, _mm_set1_epi32(-1)));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vceq(T v1, T v2)
+{
+    return __store<R>(__cmpeq<typename T::elementType>(__load(v1), __load(v2)));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcgt(T v1, T v2)
+{
+    return __store<R>(__cmpgt<typename T::elementType>(__load(v1), __load(v2)));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcge(T v1, T v2)
+{
+    return __store<R>(__cmpge<typename T::elementType>(__load(v1), __load(v2)));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vclt(T v1, T v2)
+{
+    return __store<R>(__cmpgt<typename T::elementType>(__load(v2), __load(v1)));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcle(T v1, T v2)
+{
+    return __store<R>(__cmpge<typename T::elementType>(__load(v2), __load(v1)));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcagt(T v1, T v2)
+{
+    return __store<R>(__cmpgt<float>(__abs_ps(__load(v1)), __abs_ps(__load(v2))));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcage(T v1, T v2)
+{
+    return __store<R>(__cmpge<float>(__abs_ps(__load(v1)), __abs_ps(__load(v2))));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcalt(T v1, T v2)
+{
+    return __store<R>(__cmpgt<float>(__abs_ps(__load(v2)), __abs_ps(__load(v1))));
+}
+
+template <typename T, typename R>
+IRIS_FORCE_INLINE R __vcale(T v1, T v2)
+{
+    return __store<R>(__cmpge<float>(__abs_ps(__load(v2)), __abs_ps(__load(v1))));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
@@ -0,0 +1,55 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_SSE_ELEMENTS
+#define IRIS_ARM_SSE_ELEMENTS
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+// Broadcasts lane n of x: one pshufd for 32 and 64-bit lanes, pshuflw or
+// pshufhw first for 16-bit ones, and punpcklbw/punpckhbw before that for
+// bytes, which turns byte n into both halves of a 16-bit lane.
+template <size_t n, size_t S>
+IRIS_FORCE_INLINE __m128i __broadcast(__m128i x)
+{
+    if constexpr (S == 1 && n < 8)
+    {
+        return __broadcast<n, 2>(_mm_unpacklo_epi8(x, x));
+    }
+    else if constexpr (S == 1)
+    {
+        return __broadcast<n - 8, 2>(_mm_unpackhi_epi8(x, x));
+    }
+    else if constexpr (S == 2)
+    {
+        constexpr int word = static_cast<int>(n % 4) * 0x55;
+        if constexpr (n < 4)
+        {
+            return _mm_shuffle_epi32(_mm_shufflelo_epi16(x, word), 0x00);
+        }
+        else
+        {
+            return _mm_shuffle_epi32(_mm_shufflehi_epi16(x, word), 0xAA);
+        }
+    }
+    else if constexpr (S == 4)
+    {
+        return _mm_shuffle_epi32(x, static_cast<int>(n) * 0x55);
+    }
+    else
+    {
+        return _mm_shuffle_epi32(x, n == 0 ? 0x44 : 0xEE);
+    }
+}
+
+template <size_t n, typename T>
+IRIS_FORCE_INLINE T __vdup_lane(T v)
+{
+    return __store<T>(__broadcast<n, sizeof(typename T::elementType)>(__load(v)));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
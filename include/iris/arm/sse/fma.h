@@ -0,0 +1,72 @@
+#include "common.h"
+#include "../estimate.h"
+
+#ifndef IRIS_ARM_SSE_FMA
+#define IRIS_ARM_SSE_FMA
+
+#if IRIS_ARM_SSE2 && (defined(__FMA__) || IRIS_ARM_RUNTIME)
+#define IRIS_ARM_FMA3 1
+#include <immintrin.h>
+#else
+#define IRIS_ARM_FMA3 0
+#endif
+
+#if IRIS_ARM_FMA3
+namespace iris::arm::sse
+{
+
+template <typename T>
+IRIS_ARM_TARGET("fma")
+T __vfma(T v1, T v2, T v3)
+{
+    __m128 a = _mm_castsi128_ps(__load(v1));
+    __m128 b = _mm_castsi128_ps(__load(v2));
+    __m128 c = _mm_castsi128_ps(__load(v3));
+    return __store<T>(_mm_castps_si128(_mm_fmadd_ps(b, c, a)));
+}
+
+template <typename T>
+IRIS_ARM_TARGET("fma")
+T __vfms(T v1, T v2, T v3)
+{
+    __m128 a = _mm_castsi128_ps(__load(v1));
+    __m128 b = _mm_castsi128_ps(__load(v2));
+    __m128 c = _mm_castsi128_ps(__load(v3));
+    // FMLS negates the operand, not the product: a NaN in v2 comes out
+    // sign-flipped, as in the scalar template, where vfnmadd would keep it
+    __m128 negated = _mm_xor_ps(b, _mm_set1_ps(-0.0f));
+    return __store<T>(_mm_castps_si128(_mm_fmadd_ps(negated, c, a)));
+}
+
+// (constant - v1 * v2) * half, the vrecps/vrsqrts step, with the half folded
+// into the operand of larger magnitude as in the scalar step. The result is
+// NaN exactly when an operand is NaN or infinity meets zero; those lanes need
+// the Arm NaN and special-case rules of the scalar step.
+template <typename T>
+IRIS_ARM_TARGET("fma")
+T __vstep(T v1, T v2, float constant, float half)
+{
+    __m128 a = _mm_castsi128_ps(__load(v1));
+    __m128 b = _mm_castsi128_ps(__load(v2));
+    __m128 magnitude = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 swap = _mm_cmplt_ps(_mm_and_ps(a, magnitude), _mm_and_ps(b, magnitude));
+    __m128 larger = _mm_or_ps(_mm_and_ps(swap, b), _mm_andnot_ps(swap, a));
+    __m128 smaller = _mm_or_ps(_mm_and_ps(swap, a), _mm_andnot_ps(swap, b));
+    __m128 result = _mm_fnmadd_ps(_mm_mul_ps(larger, _mm_set1_ps(half)), smaller, _mm_set1_ps(constant * half));
+    constexpr int lanes = (1 << T::length) - 1;
+    if (_mm_movemask_ps(_mm_cmpunord_ps(result, result)) & lanes)
+    {
+        T scalar;
+        for (size_t i = 0; i < T::length; i++)
+        {
+            scalar.template at<float>(i) = estimate::__step(v1.template at<float>(i), v2.template at<float>(i), constant, half);
+        }
+        return scalar;
+    }
+    return __store<T>(_mm_castps_si128(result));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
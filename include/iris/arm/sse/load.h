@@ -0,0 +1,153 @@
+#include "common.h"
+#include <array>
+
+#ifndef IRIS_ARM_SSE_LOAD
+#define IRIS_ARM_SSE_LOAD
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+// Loads the 8 or 16 bytes at src into the low part of a register.
+template <size_t bytes>
+IRIS_FORCE_INLINE __m128i __load_bytes(const void *src)
+{
+    if constexpr (bytes >= 16)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    }
+    else
+    {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src));
+    }
+}
+
+// Even and odd E lanes of the 32 bytes a:b.
+template <typename E>
+IRIS_FORCE_INLINE void __deinterleave2(__m128i a, __m128i b, __m128i &even, __m128i &odd)
+{
+    if constexpr (sizeof(E) == 1)
+    {
+        __m128i low = _mm_set1_epi16(0x00FF);
+        even = _mm_packus_epi16(_mm_and_si128(a, low), _mm_and_si128(b, low));
+        odd = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        even = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+        odd = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+    }
+    else if constexpr (sizeof(E) == 4)
+    {
+        even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+        odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    else
+    {
+        even = _mm_unpacklo_epi64(a, b);
+        odd = _mm_unpackhi_epi64(a, b);
+    }
+}
+
+#if IRIS_ARM_SSSE3
+// pshufb mask gathering the bytes of register r that belong to vector k
+// when N vectors of S-byte lanes are stored interleaved
+template <size_t S, size_t N, size_t k, size_t r>
+constexpr std::array<int8_t, 16> __deinterleave_mask()
+{
+    std::array<int8_t, 16> mask{};
+    for (size_t p = 0; p < 16; p++)
+    {
+        size_t source = ((p / S) * N + k) * S + p % S;
+        mask[p] = static_cast<int8_t>(source / 16 == r ? source % 16 : 0x80);
+    }
+    return mask;
+}
+
+template <size_t S, size_t N, size_t k, size_t r>
+IRIS_ARM_TARGET("ssse3")
+__m128i __gather(__m128i x)
+{
+    static constexpr std::array<int8_t, 16> mask = __deinterleave_mask<S, N, k, r>();
+    return _mm_shuffle_epi8(x, _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask.data())));
+}
+
+// vld3: three registers for 128-bit vectors, 16 + 8 bytes for 64-bit ones
+template <typename T>
+IRIS_ARM_TARGET("ssse3")
+void __vld3_ssse3(T &result, const typename T::vectorType::elementType *src)
+{
+    using V = typename T::vectorType;
+    using E = typename V::elementType;
+    constexpr size_t bytes = V::byteSize;
+    const int8_t *bytesrc = reinterpret_cast<const int8_t *>(src);
+    __m128i x0 = __load_bytes<16>(bytesrc);
+    __m128i x1 = __load_bytes<3 * bytes - 16>(bytesrc + 16);
+    __m128i x2 = bytes == 16 ? __load_bytes<16>(bytesrc + 32) : _mm_setzero_si128();
+    result.val[0] = __store<V>(_mm_or_si128(_mm_or_si128(__gather<sizeof(E), 3, 0, 0>(x0), __gather<sizeof(E), 3, 0, 1>(x1)), __gather<sizeof(E), 3, 0, 2>(x2)));
+    result.val[1] = __store<V>(_mm_or_si128(_mm_or_si128(__gather<sizeof(E), 3, 1, 0>(x0), __gather<sizeof(E), 3, 1, 1>(x1)), __gather<sizeof(E), 3, 1, 2>(x2)));
+    result.val[2] = __store<V>(_mm_or_si128(_mm_or_si128(__gather<sizeof(E), 3, 2, 0>(x0), __gather<sizeof(E), 3, 2, 1>(x1)), __gather<sizeof(E), 3, 2, 2>(x2)));
+}
+#endif
+
+// Deinterleaves into the caller's result, which is the family template's
+// return value, so the 32 to 64 byte aggregate is written in place.
+template <typename T, typename B>
+IRIS_FORCE_INLINE void __vld(T &result, const typename T::vectorType::elementType *src)
+{
+    using V = typename T::vectorType;
+    using E = typename V::elementType;
+    constexpr size_t N = T::lanes;
+    constexpr size_t bytes = V::byteSize;
+    if constexpr (N == 2)
+    {
+        // 64-bit vectors fit in one register; its upper results are ignored
+        __m128i x0 = __load_bytes<16>(src);
+        __m128i x1 = bytes == 16 ? __load_bytes<16>(src + V::length) : x0;
+        __m128i even, odd;
+        __deinterleave2<E>(x0, x1, even, odd);
+        result.val[0] = __store<V>(even);
+        result.val[1] = __store<V>(odd);
+    }
+    else if constexpr (N == 4)
+    {
+        const int8_t *bytesrc = reinterpret_cast<const int8_t *>(src);
+        __m128i e01, o01, e23, o23;
+        __deinterleave2<E>(__load_bytes<16>(bytesrc), __load_bytes<16>(bytesrc + 16), e01, o01);
+        if constexpr (bytes == 16)
+        {
+            __deinterleave2<E>(__load_bytes<16>(bytesrc + 32), __load_bytes<16>(bytesrc + 48), e23, o23);
+        }
+        else
+        {
+            e23 = e01;
+            o23 = o01;
+        }
+        __m128i l0, l1, l2, l3;
+        __deinterleave2<E>(e01, e23, l0, l2);
+        __deinterleave2<E>(o01, o23, l1, l3);
+        result.val[0] = __store<V>(l0);
+        result.val[1] = __store<V>(l1);
+        result.val[2] = __store<V>(l2);
+        result.val[3] = __store<V>(l3);
+    }
+    else
+    {
+#if IRIS_ARM_SSSE3
+        if (__supports<B>(tier::ssse3))
+        {
+            __vld3_ssse3<T>(result, src);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < N * V::length; i++)
+        {
+            result.val[i % N].template at<E>(i / N) = src[i];
+        }
+    }
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
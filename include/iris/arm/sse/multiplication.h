@@ -0,0 +1,154 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_SSE_MULTIPLICATION
+#define IRIS_ARM_SSE_MULTIPLICATION
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+#if IRIS_ARM_SSE41
+IRIS_ARM_TARGET("sse4.1")
+__m128i __mul_epi32(__m128i a, __m128i b)
+{
+    return _mm_mul_epi32(a, b);
+}
+#endif
+
+#if IRIS_ARM_SSSE3
+IRIS_ARM_TARGET("ssse3")
+__m128i __mulhrs_epi16(__m128i a, __m128i b)
+{
+    return _mm_mulhrs_epi16(a, b);
+}
+#endif
+
+// Signed 64-bit products of the 32-bit lanes 0 and 2.
+template <typename B>
+IRIS_FORCE_INLINE __m128i __muldq(__m128i a, __m128i b)
+{
+#if IRIS_ARM_SSE41
+    if (__supports<B>(tier::sse41))
+    {
+        return __mul_epi32(a, b);
+    }
+#endif
+    // signed product = unsigned product - ((a < 0 ? b : 0) + (b < 0 ? a : 0)) << 32
+    __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(fix, 32));
+}
+
+template <typename T, typename R, typename B>
+IRIS_FORCE_INLINE R __vmull(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (sizeof(E) == 1)
+    {
+        // 8x8 products always fit in 16 bits, signed or not
+        return __store<R>(_mm_mullo_epi16(__widen<E, B>(a), __widen<E, B>(b)));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        __m128i high = std::is_signed<E>::value ? _mm_mulhi_epi16(a, b) : _mm_mulhi_epu16(a, b);
+        return __store<R>(_mm_unpacklo_epi16(_mm_mullo_epi16(a, b), high));
+    }
+    else
+    {
+        // pmuludq/pmuldq read lanes 0 and 2
+        a = _mm_unpacklo_epi32(a, a);
+        b = _mm_unpacklo_epi32(b, b);
+        if constexpr (!std::is_signed<E>::value)
+        {
+            return __store<R>(_mm_mul_epu32(a, b));
+        }
+        else
+        {
+            return __store<R>(__muldq<B>(a, b));
+        }
+    }
+}
+
+// The doubling multiplies only overflow for min * min, which wraps to the
+// minimum. No other pair of lanes yields the minimum, so those lanes are
+// flipped to the maximum.
+template <typename E>
+IRIS_FORCE_INLINE __m128i __saturate_min(__m128i x)
+{
+    __m128i min = __set1_min<E>();
+    if constexpr (sizeof(E) == 2)
+    {
+        return _mm_xor_si128(x, _mm_cmpeq_epi16(x, min));
+    }
+    else
+    {
+        return _mm_xor_si128(x, _mm_cmpeq_epi32(x, min));
+    }
+}
+
+// (2ab + rounding) >> bits per lane
+template <bool rounding, typename T, typename B>
+IRIS_FORCE_INLINE T __vqdmulh(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (sizeof(E) == 2)
+    {
+#if IRIS_ARM_SSSE3
+        if (rounding && __supports<B>(tier::ssse3))
+        {
+            return __store<T>(__saturate_min<E>(__mulhrs_epi16(a, b)));
+        }
+#endif
+        // (ab + rounding / 2) >> 15 on the 32-bit products; packssdw
+        // saturates min * min
+        __m128i lo = _mm_mullo_epi16(a, b);
+        __m128i hi = _mm_mulhi_epi16(a, b);
+        __m128i round = _mm_set1_epi32(rounding ? 1 << 14 : 0);
+        __m128i first = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), round), 15);
+        __m128i second = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), round), 15);
+        return __store<T>(_mm_packs_epi32(first, second));
+    }
+    else
+    {
+        // bits 31..62 of ab + rounding / 2, moved to the upper half of each
+        // 64-bit product
+        __m128i round = __set1<int64_t>(rounding ? int64_t(1) << 30 : 0);
+        __m128i even = __muldq<B>(a, b);
+        __m128i odd = __muldq<B>(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        even = _mm_slli_epi64(_mm_add_epi64(even, round), 1);
+        odd = _mm_slli_epi64(_mm_add_epi64(odd, round), 1);
+        __m128i high = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_and_si128(odd, __set1<int64_t>(~int64_t(0xffffffff))));
+        return __store<T>(__saturate_min<E>(high));
+    }
+}
+
+// 2ab in twice the width
+template <typename T, typename R, typename B>
+IRIS_FORCE_INLINE R __vqdmull(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (sizeof(E) == 2)
+    {
+        __m128i product = _mm_unpacklo_epi16(_mm_mullo_epi16(a, b), _mm_mulhi_epi16(a, b));
+        return __store<R>(__saturate_min<int32_t>(_mm_add_epi32(product, product)));
+    }
+    else
+    {
+        a = _mm_unpacklo_epi32(a, a);
+        b = _mm_unpacklo_epi32(b, b);
+        __m128i product = __muldq<B>(a, b);
+        __m128i min = __set1_min<int32_t>();
+        __m128i overflow = _mm_and_si128(_mm_cmpeq_epi32(a, min), _mm_cmpeq_epi32(b, min));
+        return __store<R>(_mm_xor_si128(_mm_add_epi64(product, product), overflow));
+    }
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
@@ -0,0 +1,182 @@
+#include "common.h"
+#include <array>
+
+#ifndef IRIS_ARM_SSE_STORE
+#define IRIS_ARM_SSE_STORE
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+// Stores the low 8 or all 16 bytes of x at dst.
+template <size_t bytes>
+IRIS_FORCE_INLINE void __store_bytes(void *dst, __m128i x)
+{
+    if constexpr (bytes >= 16)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), x);
+    }
+    else
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), x);
+    }
+}
+
+// punpckl/punpckh on W-byte lanes; W == 16 keeps the whole register
+template <size_t W>
+IRIS_FORCE_INLINE __m128i __unpacklo(__m128i a, __m128i b)
+{
+    if constexpr (W == 1)
+    {
+        return _mm_unpacklo_epi8(a, b);
+    }
+    else if constexpr (W == 2)
+    {
+        return _mm_unpacklo_epi16(a, b);
+    }
+    else if constexpr (W == 4)
+    {
+        return _mm_unpacklo_epi32(a, b);
+    }
+    else if constexpr (W == 8)
+    {
+        return _mm_unpacklo_epi64(a, b);
+    }
+    else
+    {
+        return a;
+    }
+}
+
+template <size_t W>
+IRIS_FORCE_INLINE __m128i __unpackhi(__m128i a, __m128i b)
+{
+    if constexpr (W == 1)
+    {
+        return _mm_unpackhi_epi8(a, b);
+    }
+    else if constexpr (W == 2)
+    {
+        return _mm_unpackhi_epi16(a, b);
+    }
+    else if constexpr (W == 4)
+    {
+        return _mm_unpackhi_epi32(a, b);
+    }
+    else if constexpr (W == 8)
+    {
+        return _mm_unpackhi_epi64(a, b);
+    }
+    else
+    {
+        return b;
+    }
+}
+
+#if IRIS_ARM_SSSE3
+// pshufb mask placing the bytes of vector k into output register r
+// when N vectors of S-byte lanes are stored interleaved
+template <size_t S, size_t N, size_t k, size_t r>
+constexpr std::array<int8_t, 16> __interleave_mask()
+{
+    std::array<int8_t, 16> mask{};
+    for (size_t p = 0; p < 16; p++)
+    {
+        size_t target = r * 16 + p;
+        size_t lane = target / S;
+        mask[p] = static_cast<int8_t>(lane % N == k ? (lane / N) * S + target % S : 0x80);
+    }
+    return mask;
+}
+
+template <size_t S, size_t N, size_t k, size_t r>
+IRIS_ARM_TARGET("ssse3")
+__m128i __scatter(__m128i x)
+{
+    static constexpr std::array<int8_t, 16> mask = __interleave_mask<S, N, k, r>();
+    return _mm_shuffle_epi8(x, _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask.data())));
+}
+
+template <size_t S, size_t r>
+IRIS_ARM_TARGET("ssse3")
+__m128i __interleave3(__m128i a, __m128i b, __m128i c)
+{
+    return _mm_or_si128(_mm_or_si128(__scatter<S, 3, 0, r>(a), __scatter<S, 3, 1, r>(b)), __scatter<S, 3, 2, r>(c));
+}
+
+template <typename T>
+IRIS_ARM_TARGET("ssse3")
+void __vst3_ssse3(typename T::vectorType::elementType *dst, const T &v)
+{
+    using V = typename T::vectorType;
+    using E = typename V::elementType;
+    constexpr size_t bytes = V::byteSize;
+    int8_t *bytedst = reinterpret_cast<int8_t *>(dst);
+    __m128i a = __load(v.val[0]);
+    __m128i b = __load(v.val[1]);
+    __m128i c = __load(v.val[2]);
+    __store_bytes<16>(bytedst, __interleave3<sizeof(E), 0>(a, b, c));
+    __store_bytes<3 * bytes - 16>(bytedst + 16, __interleave3<sizeof(E), 1>(a, b, c));
+    if constexpr (bytes == 16)
+    {
+        __store_bytes<16>(bytedst + 32, __interleave3<sizeof(E), 2>(a, b, c));
+    }
+}
+#endif
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE void __vst(typename T::vectorType::elementType *dst, const T &v)
+{
+    using V = typename T::vectorType;
+    using E = typename V::elementType;
+    constexpr size_t N = T::lanes;
+    constexpr size_t bytes = V::byteSize;
+    int8_t *bytedst = reinterpret_cast<int8_t *>(dst);
+    if constexpr (N == 2)
+    {
+        __m128i a = __load(v.val[0]);
+        __m128i b = __load(v.val[1]);
+        __store_bytes<16>(bytedst, __unpacklo<sizeof(E)>(a, b));
+        if constexpr (bytes == 16)
+        {
+            __store_bytes<16>(bytedst + 16, __unpackhi<sizeof(E)>(a, b));
+        }
+    }
+    else if constexpr (N == 4)
+    {
+        __m128i a = __load(v.val[0]);
+        __m128i b = __load(v.val[1]);
+        __m128i c = __load(v.val[2]);
+        __m128i d = __load(v.val[3]);
+        __m128i ab = __unpacklo<sizeof(E)>(a, b);
+        __m128i cd = __unpacklo<sizeof(E)>(c, d);
+        __store_bytes<16>(bytedst, __unpacklo<2 * sizeof(E)>(ab, cd));
+        __store_bytes<16>(bytedst + 16, __unpackhi<2 * sizeof(E)>(ab, cd));
+        if constexpr (bytes == 16)
+        {
+            ab = __unpackhi<sizeof(E)>(a, b);
+            cd = __unpackhi<sizeof(E)>(c, d);
+            __store_bytes<16>(bytedst + 32, __unpacklo<2 * sizeof(E)>(ab, cd));
+            __store_bytes<16>(bytedst + 48, __unpackhi<2 * sizeof(E)>(ab, cd));
+        }
+    }
+    else
+    {
+#if IRIS_ARM_SSSE3
+        if (__supports<B>(tier::ssse3))
+        {
+            __vst3_ssse3<T>(dst, v);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < N * V::length; i++)
+        {
+            dst[i] = v.val[i % N].template at<E>(i / N);
+        }
+    }
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
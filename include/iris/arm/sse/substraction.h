@@ -0,0 +1,114 @@
+#include "common.h"
+#include <limits>
+
+#ifndef IRIS_ARM_SSE_SUBSTRACTION
+#define IRIS_ARM_SSE_SUBSTRACTION
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vsub(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return __store<T>(_mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))));
+    }
+    else
+    {
+        return __store<T>(__sub<E>(a, b));
+    }
+}
+
+// floor((a - b) / 2) on unsigned lanes: a - b == (a ^ b) - 2 * (~a & b)
+template <typename E>
+IRIS_FORCE_INLINE __m128i __hsub_unsigned(__m128i a, __m128i b)
+{
+    __m128i x = _mm_xor_si128(a, b);
+    __m128i borrow = _mm_andnot_si128(a, b);
+    if constexpr (sizeof(E) == 1)
+    {
+        __m128i half = _mm_and_si128(_mm_srli_epi16(x, 1), _mm_set1_epi8(0x7F));
+        return _mm_sub_epi8(half, borrow);
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_sub_epi16(_mm_srli_epi16(x, 1), borrow);
+    }
+    else
+    {
+        return _mm_sub_epi32(_mm_srli_epi32(x, 1), borrow);
+    }
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vhsub(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (std::is_signed<E>::value)
+    {
+        // Biasing both operands keeps their difference, so no bias on the way back.
+        __m128i bias = __sign_bias<E>();
+        return __store<T>(__hsub_unsigned<E>(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)));
+    }
+    else
+    {
+        return __store<T>(__hsub_unsigned<E>(a, b));
+    }
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vqsub(T v1, T v2)
+{
+    using E = typename T::elementType;
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (sizeof(E) == 1)
+    {
+        return __store<T>(std::is_signed<E>::value ? _mm_subs_epi8(a, b) : _mm_subs_epu8(a, b));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return __store<T>(std::is_signed<E>::value ? _mm_subs_epi16(a, b) : _mm_subs_epu16(a, b));
+    }
+    else
+    {
+        __m128i difference = sizeof(E) == 4 ? _mm_sub_epi32(a, b) : _mm_sub_epi64(a, b);
+        if constexpr (std::is_signed<E>::value)
+        {
+            // Overflow when the operand signs differ and the result takes the sign of b.
+            __m128i overflow = __sign_mask<E>(_mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, difference)));
+            __m128i saturated = _mm_xor_si128(__sign_mask<E>(a), __set1_max<E>());
+            return __store<T>(__select(overflow, saturated, difference));
+        }
+        else
+        {
+            __m128i borrow = _mm_or_si128(_mm_andnot_si128(a, b), _mm_andnot_si128(_mm_xor_si128(a, b), difference));
+            return __store<T>(_mm_andnot_si128(__sign_mask<E>(borrow), difference));
+        }
+    }
+}
+
+template <typename T, typename R, typename B>
+IRIS_FORCE_INLINE R __vsubl(T v1, T v2)
+{
+    using E = typename T::elementType;
+    return __store<R>(__sub<typename R::elementType>(__widen<E, B>(__load(v1)), __widen<E, B>(__load(v2))));
+}
+
+template <typename R, typename T, typename B>
+IRIS_FORCE_INLINE R __vsubw(R v1, T v2)
+{
+    return __store<R>(__sub<typename R::elementType>(__load(v1), __widen<typename T::elementType, B>(__load(v2))));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
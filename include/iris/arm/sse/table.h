@@ -0,0 +1,97 @@
+#include "common.h"
+
+#ifndef IRIS_ARM_SSE_TABLE
+#define IRIS_ARM_SSE_TABLE
+
+#if IRIS_ARM_SSSE3
+namespace iris::arm::sse
+{
+
+template <size_t count>
+struct __table_registers
+{
+    __m128i reg[count];
+};
+
+// Table bytes as 16-byte registers: 8-byte tables are packed in pairs and the
+// odd one out gets a zero upper half, which reads back as the 0 of an index
+// past the table.
+template <typename E, size_t len>
+IRIS_ARM_TARGET("ssse3")
+__table_registers<1> __registers(const iris::common::vector<E, len> &t)
+{
+    if constexpr (sizeof(E) * len == 16)
+    {
+        return {__load(t)};
+    }
+    else
+    {
+        return {_mm_move_epi64(__load(t))};
+    }
+}
+
+template <typename V, size_t n>
+IRIS_ARM_TARGET("ssse3")
+__table_registers<(n * V::byteSize + 15) / 16> __registers(const iris::common::multi_vector<V, n> &t)
+{
+    __table_registers<(n * V::byteSize + 15) / 16> regs;
+    if constexpr (V::byteSize == 16)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            regs.reg[k] = __load(t.val[k]);
+        }
+    }
+    else
+    {
+        for (size_t k = 0; k + 1 < n; k += 2)
+        {
+            regs.reg[k / 2] = _mm_unpacklo_epi64(__load(t.val[k]), __load(t.val[k + 1]));
+        }
+        if constexpr (n % 2 != 0)
+        {
+            regs.reg[n / 2] = _mm_move_epi64(__load(t.val[n - 1]));
+        }
+    }
+    return regs;
+}
+
+// One pshufb per table register on the index minus its offset. The saturating
+// add of 0x70 keeps indices 0..15 below 0x80 and pushes every other one,
+// including those that wrapped below zero, to 0x80 or more, which pshufb
+// turns into 0.
+template <size_t count>
+IRIS_ARM_TARGET("ssse3")
+__m128i __lookup(const __table_registers<count> &regs, __m128i idx)
+{
+    const __m128i bias = _mm_set1_epi8(0x70);
+    __m128i result = _mm_shuffle_epi8(regs.reg[0], _mm_adds_epu8(idx, bias));
+    for (size_t k = 1; k < count; k++)
+    {
+        idx = _mm_sub_epi8(idx, _mm_set1_epi8(16));
+        result = _mm_or_si128(result, _mm_shuffle_epi8(regs.reg[k], _mm_adds_epu8(idx, bias)));
+    }
+    return result;
+}
+
+template <typename R, size_t size, typename Table, typename I>
+IRIS_ARM_TARGET("ssse3")
+R __vtbl(const Table &t, I idx)
+{
+    return __store<R>(__lookup(__registers(t), __load(idx)));
+}
+
+// lanes whose index is past the table keep the lane of a
+template <typename R, size_t size, typename Table, typename I>
+IRIS_ARM_TARGET("ssse3")
+R __vtbx(R a, const Table &t, I idx)
+{
+    __m128i x = __load(idx);
+    __m128i inside = _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(static_cast<char>(size - 1))), x);
+    return __store<R>(_mm_or_si128(__lookup(__registers(t), x), _mm_andnot_si128(inside, __load(a))));
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
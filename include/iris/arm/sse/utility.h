@@ -0,0 +1,140 @@
+#include "common.h"
+#include <array>
+#include <utility>
+
+#ifndef IRIS_ARM_SSE_UTILITY
+#define IRIS_ARM_SSE_UTILITY
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+// pshufb mask reversing the S-byte lanes inside every G-byte group
+template <size_t S, size_t G>
+constexpr std::array<int8_t, 16> __reverse_mask()
+{
+    std::array<int8_t, 16> mask{};
+    for (size_t j = 0; j < 16; j++)
+    {
+        size_t group = j - j % G;
+        size_t lane = (j % G) / S;
+        mask[j] = static_cast<int8_t>(group + (G / S - 1 - lane) * S + j % S);
+    }
+    return mask;
+}
+
+#if IRIS_ARM_SSSE3
+template <typename E, size_t G>
+IRIS_ARM_TARGET("ssse3")
+__m128i __reverse_ssse3(__m128i x)
+{
+    static constexpr std::array<int8_t, 16> mask = __reverse_mask<sizeof(E), G>();
+    return _mm_shuffle_epi8(x, _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask.data())));
+}
+
+template <int bytes>
+IRIS_ARM_TARGET("ssse3")
+__m128i __alignr(__m128i b, __m128i a)
+{
+    return _mm_alignr_epi8(b, a, bytes);
+}
+#endif
+
+// Reverses the E lanes inside every G-byte group.
+template <typename E, size_t G, typename B>
+IRIS_FORCE_INLINE __m128i __reverse(__m128i x)
+{
+#if IRIS_ARM_SSSE3
+    if (__supports<B>(tier::ssse3))
+    {
+        return __reverse_ssse3<E, G>(x);
+    }
+#endif
+    if constexpr (sizeof(E) == 1)
+    {
+        x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        if constexpr (G == 2)
+        {
+            return x;
+        }
+        else
+        {
+            return __reverse<int16_t, G, B>(x);
+        }
+    }
+    else if constexpr (sizeof(E) == 2 && G == 4)
+    {
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    else
+    {
+        return _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+}
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vrev64(T v)
+{
+    return __store<T>(__reverse<typename T::elementType, 8, B>(__load(v)));
+}
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vrev32(T v)
+{
+    return __store<T>(__reverse<typename T::elementType, 4, B>(__load(v)));
+}
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vrev16(T v)
+{
+    return __store<T>(__reverse<typename T::elementType, 2, B>(__load(v)));
+}
+
+// vext with the lane index as an immediate: lanes n.. of v1 followed by v2
+template <size_t n, typename T, typename B>
+IRIS_FORCE_INLINE T __vext(T v1, T v2)
+{
+    constexpr int bytes = static_cast<int>(n * sizeof(typename T::elementType));
+    __m128i a = __load(v1);
+    __m128i b = __load(v2);
+    if constexpr (T::byteSize == 8)
+    {
+        return __store<T>(_mm_srli_si128(_mm_unpacklo_epi64(a, b), bytes));
+    }
+    else if constexpr (bytes == 0)
+    {
+        return v1;
+    }
+    else
+    {
+#if IRIS_ARM_SSSE3
+        if (__supports<B>(tier::ssse3))
+        {
+            return __store<T>(__alignr<bytes>(b, a));
+        }
+#endif
+        return __store<T>(_mm_or_si128(_mm_srli_si128(a, bytes), _mm_slli_si128(b, 16 - bytes)));
+    }
+}
+
+template <typename T, typename B, size_t... n>
+IRIS_FORCE_INLINE T __vext_table(T v1, T v2, int32_t i, std::index_sequence<n...>)
+{
+    static constexpr T (*table[])(T, T) = {&__vext<n, T, B>...};
+    return table[i](v1, v2);
+}
+
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vext(T v1, T v2, int32_t n)
+{
+    return __vext_table<T, B>(v1, v2, n, std::make_index_sequence<T::length>());
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
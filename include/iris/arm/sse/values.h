@@ -0,0 +1,175 @@
+#include "common.h"
+#include "../estimate.h"
+#include <limits>
+
+#ifndef IRIS_ARM_SSE_VALUES
+#define IRIS_ARM_SSE_VALUES
+
+#if IRIS_ARM_SSE2
+namespace iris::arm::sse
+{
+
+template <typename T>
+IRIS_FORCE_INLINE T __vqneg(T v)
+{
+    using E = typename T::elementType;
+    __m128i x = __load(v);
+    if constexpr (sizeof(E) == 1)
+    {
+        return __store<T>(_mm_subs_epi8(_mm_setzero_si128(), x));
+    }
+    else if constexpr (sizeof(E) == 2)
+    {
+        return __store<T>(_mm_subs_epi16(_mm_setzero_si128(), x));
+    }
+    else
+    {
+        // Only min negates onto itself; flipping all its bits gives max.
+        __m128i negated = _mm_sub_epi32(_mm_setzero_si128(), x);
+        __m128i overflow = _mm_cmpeq_epi32(x, __set1_min<E>());
+        return __store<T>(_mm_xor_si128(negated, overflow));
+    }
+}
+
+template <typename T>
+IRIS_FORCE_INLINE T __vqabs(T v)
+{
+    using E = typename T::elementType;
+    __m128i x = __load(v);
+    if constexpr (std::is_floating_point<E>::value)
+    {
+        return __store<T>(_mm_andnot_si128(_mm_set1_epi32(static_cast<int>(0x80000000)), x));
+    }
+    else
+    {
+        // |x| == (x ^ s) - s with s the lane sign mask; the saturating forms clamp abs(min).
+        __m128i sign = __sign_mask<E>(x);
+        __m128i flipped = _mm_xor_si128(x, sign);
+        if constexpr (sizeof(E) == 1)
+        {
+            return __store<T>(_mm_subs_epi8(flipped, sign));
+        }
+        else if constexpr (sizeof(E) == 2)
+        {
+            return __store<T>(_mm_subs_epi16(flipped, sign));
+        }
+        else
+        {
+            __m128i absolute = _mm_sub_epi32(flipped, sign);
+            __m128i overflow = _mm_cmpeq_epi32(x, __set1_min<E>());
+            return __store<T>(_mm_xor_si128(absolute, overflow));
+        }
+    }
+}
+
+#if IRIS_ARM_AVX2
+IRIS_ARM_TARGET("avx2")
+__m128i __gather32(const uint32_t *table, __m128i index)
+{
+    return _mm_i32gather_epi32(reinterpret_cast<const int *>(table), index, 4);
+}
+#endif
+
+// Table entries of the four 32-bit lane indices: one gather with AVX2, four
+// scalar loads below it.
+template <typename B>
+IRIS_FORCE_INLINE __m128i __lookup32(const uint32_t *table, __m128i index)
+{
+#if IRIS_ARM_AVX2
+    if (__supports<B>(tier::avx2))
+    {
+        return __gather32(table, index);
+    }
+#endif
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), index);
+    return _mm_setr_epi32(static_cast<int>(table[lanes[0]]), static_cast<int>(table[lanes[1]]),
+                          static_cast<int>(table[lanes[2]]), static_cast<int>(table[lanes[3]]));
+}
+
+// true when every lane of T is set in the 32-bit lane mask
+template <typename T>
+IRIS_FORCE_INLINE bool __all_lanes(__m128i mask)
+{
+    constexpr int lanes = (1 << T::length) - 1;
+    return (_mm_movemask_ps(_mm_castsi128_ps(mask)) & lanes) == lanes;
+}
+
+template <typename T, typename F>
+IRIS_FORCE_INLINE T __per_lane(T v, F f)
+{
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        using E = typename T::elementType;
+        result.template at<E>(i) = estimate::__lane<E>(f(estimate::__bits(v.template at<E>(i))));
+    }
+    return result;
+}
+
+// Float lanes with exponents 1..252 have normal estimates taken straight from
+// the table; zeros, denormals, infinities, NaNs and lanes whose estimate is
+// denormal go through the scalar helper.
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vrecpe(T v)
+{
+    __m128i x = __load(v);
+    if constexpr (std::is_floating_point<typename T::elementType>::value)
+    {
+        __m128i exponent = _mm_and_si128(_mm_srli_epi32(x, 23), _mm_set1_epi32(0xff));
+        __m128i normal = _mm_and_si128(_mm_cmpgt_epi32(exponent, _mm_setzero_si128()), _mm_cmplt_epi32(exponent, _mm_set1_epi32(253)));
+        if (!__all_lanes<T>(normal))
+        {
+            return __per_lane(v, estimate::__recpe);
+        }
+        __m128i index = _mm_and_si128(_mm_srli_epi32(x, 15), _mm_set1_epi32(0xff));
+        __m128i fraction = _mm_slli_epi32(_mm_and_si128(__lookup32<B>(estimate::__table.recip, index), _mm_set1_epi32(0xff)), 15);
+        __m128i sign = _mm_and_si128(x, _mm_set1_epi32(static_cast<int>(estimate::__sign)));
+        return __store<T>(_mm_or_si128(_mm_or_si128(sign, _mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(253), exponent), 23)), fraction));
+    }
+    else
+    {
+        // lanes below 0.5 saturate to all ones
+        __m128i valid = _mm_cmpgt_epi32(_mm_setzero_si128(), x);
+        __m128i index = _mm_and_si128(_mm_srli_epi32(x, 23), _mm_set1_epi32(0xff));
+        __m128i entry = _mm_slli_epi32(__lookup32<B>(estimate::__table.recip, index), 23);
+        return __store<T>(_mm_or_si128(_mm_and_si128(valid, entry), _mm_andnot_si128(valid, _mm_set1_epi32(-1))));
+    }
+}
+
+// Positive normal float lanes index the table by the fraction and the parity
+// of the exponent; every other lane goes through the scalar helper.
+template <typename T, typename B>
+IRIS_FORCE_INLINE T __vrsqrte(T v)
+{
+    __m128i x = __load(v);
+    if constexpr (std::is_floating_point<typename T::elementType>::value)
+    {
+        __m128i normal = _mm_and_si128(_mm_cmpgt_epi32(x, _mm_set1_epi32(0x007fffff)), _mm_cmplt_epi32(x, _mm_set1_epi32(0x7f800000)));
+        if (!__all_lanes<T>(normal))
+        {
+            return __per_lane(v, estimate::__rsqrte);
+        }
+        __m128i exponent = _mm_srli_epi32(x, 23);
+        __m128i odd = _mm_cmpeq_epi32(_mm_and_si128(exponent, _mm_set1_epi32(1)), _mm_set1_epi32(1));
+        __m128i quarter = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0x7f));
+        __m128i half = _mm_add_epi32(_mm_and_si128(_mm_srli_epi32(x, 15), _mm_set1_epi32(0xff)), _mm_set1_epi32(128));
+        __m128i index = _mm_or_si128(_mm_and_si128(odd, quarter), _mm_andnot_si128(odd, half));
+        __m128i fraction = _mm_slli_epi32(_mm_and_si128(__lookup32<B>(estimate::__table.rsqrt, index), _mm_set1_epi32(0xff)), 15);
+        __m128i resultExponent = _mm_srli_epi32(_mm_sub_epi32(_mm_set1_epi32(380), exponent), 1);
+        return __store<T>(_mm_or_si128(_mm_slli_epi32(resultExponent, 23), fraction));
+    }
+    else
+    {
+        // lanes below 0.25 saturate to all ones; their index is cleared to stay in the table
+        __m128i valid = _mm_xor_si128(_mm_cmpeq_epi32(_mm_srli_epi32(x, 30), _mm_setzero_si128()), _mm_set1_epi32(-1));
+        __m128i index = _mm_and_si128(valid, _mm_sub_epi32(_mm_srli_epi32(x, 23), _mm_set1_epi32(128)));
+        __m128i entry = _mm_slli_epi32(__lookup32<B>(estimate::__table.rsqrt, index), 23);
+        return __store<T>(_mm_or_si128(_mm_and_si128(valid, entry), _mm_andnot_si128(valid, _mm_set1_epi32(-1))));
+    }
+}
+
+} // namespace iris::arm::sse
+#endif
+
+#endif
@@ -1,4 +1,6 @@
 #include "common.h"
+#include <cstring>
+#include "sse/store.h"
 
 #ifndef IRIS_ARM_STORE
 #define IRIS_ARM_STORE
@@ -6,64 +8,246 @@
 namespace iris::arm::store
 {
 template <typename T>
-void __vst1(typename T::elementType *dst, T v)
+IRIS_INLINE void __vst1(typename T::elementType *dst, T v)
 {
-    std::memcpy(dst, &v, sizeof(T));
+    std::memcpy(dst, &v.value, T::byteSize);
 }
 
-const auto &vst1_u8 = __vst1<uint8x8_t>;
-const auto &vst1_u16 = __vst1<uint16x4_t>;
-const auto &vst1_u32 = __vst1<uint32x2_t>;
-const auto &vst1_u64 = __vst1<uint64x1_t>;
+constexpr auto vst1_u8 = __vst1<uint8x8_t>;
+constexpr auto vst1_u16 = __vst1<uint16x4_t>;
+constexpr auto vst1_u32 = __vst1<uint32x2_t>;
+constexpr auto vst1_u64 = __vst1<uint64x1_t>;
 
-const auto &vst1_s8 = __vst1<int8x8_t>;
-const auto &vst1_s16 = __vst1<int16x4_t>;
-const auto &vst1_s32 = __vst1<int32x2_t>;
-const auto &vst1_s64 = __vst1<int64x1_t>;
+constexpr auto vst1_s8 = __vst1<int8x8_t>;
+constexpr auto vst1_s16 = __vst1<int16x4_t>;
+constexpr auto vst1_s32 = __vst1<int32x2_t>;
+constexpr auto vst1_s64 = __vst1<int64x1_t>;
 
-const auto &vst1_f32 = __vst1<float32x2_t>;
+constexpr auto vst1_f32 = __vst1<float32x2_t>;
 
-const auto &vst1q_u8 = __vst1<uint8x16_t>;
-const auto &vst1q_u16 = __vst1<uint16x8_t>;
-const auto &vst1q_u32 = __vst1<uint32x4_t>;
-const auto &vst1q_u64 = __vst1<uint64x2_t>;
+constexpr auto vst1q_u8 = __vst1<uint8x16_t>;
+constexpr auto vst1q_u16 = __vst1<uint16x8_t>;
+constexpr auto vst1q_u32 = __vst1<uint32x4_t>;
+constexpr auto vst1q_u64 = __vst1<uint64x2_t>;
 
-const auto &vst1q_s8 = __vst1<int8x16_t>;
-const auto &vst1q_s16 = __vst1<int16x8_t>;
-const auto &vst1q_s32 = __vst1<int32x4_t>;
-const auto &vst1q_s64 = __vst1<int64x2_t>;
+constexpr auto vst1q_s8 = __vst1<int8x16_t>;
+constexpr auto vst1q_s16 = __vst1<int16x8_t>;
+constexpr auto vst1q_s32 = __vst1<int32x4_t>;
+constexpr auto vst1q_s64 = __vst1<int64x2_t>;
 
-const auto &vst1q_f32 = __vst1<float32x4_t>;
+constexpr auto vst1q_f32 = __vst1<float32x4_t>;
 
 template <typename T>
-void __vst1_lane(typename T::elementType *dst, T v, int pos)
+IRIS_INLINE void __vst1_lane(typename T::elementType *dst, T v, int pos)
 {
     *dst = v.template at<typename T::elementType>(pos);
 }
 
-const auto &vst1_lane_u8 = __vst1_lane<uint8x8_t>;
-const auto &vst1_lane_u16 = __vst1_lane<uint16x4_t>;
-const auto &vst1_lane_u32 = __vst1_lane<uint32x2_t>;
-const auto &vst1_lane_u64 = __vst1_lane<uint64x1_t>;
+constexpr auto vst1_lane_u8 = __vst1_lane<uint8x8_t>;
+constexpr auto vst1_lane_u16 = __vst1_lane<uint16x4_t>;
+constexpr auto vst1_lane_u32 = __vst1_lane<uint32x2_t>;
+constexpr auto vst1_lane_u64 = __vst1_lane<uint64x1_t>;
 
-const auto &vst1_lane_s8 = __vst1_lane<int8x8_t>;
-const auto &vst1_lane_s16 = __vst1_lane<int16x4_t>;
-const auto &vst1_lane_s32 = __vst1_lane<int32x2_t>;
-const auto &vst1_lane_s64 = __vst1_lane<int64x1_t>;
+constexpr auto vst1_lane_s8 = __vst1_lane<int8x8_t>;
+constexpr auto vst1_lane_s16 = __vst1_lane<int16x4_t>;
+constexpr auto vst1_lane_s32 = __vst1_lane<int32x2_t>;
+constexpr auto vst1_lane_s64 = __vst1_lane<int64x1_t>;
 
-const auto &vst1_lane_f32 = __vst1_lane<float32x2_t>;
+constexpr auto vst1_lane_f32 = __vst1_lane<float32x2_t>;
 
-const auto &vst1q_lane_u8 = __vst1_lane<uint8x16_t>;
-const auto &vst1q_lane_u16 = __vst1_lane<uint16x8_t>;
-const auto &vst1q_lane_u32 = __vst1_lane<uint32x4_t>;
-const auto &vst1q_lane_u64 = __vst1_lane<uint64x2_t>;
+constexpr auto vst1q_lane_u8 = __vst1_lane<uint8x16_t>;
+constexpr auto vst1q_lane_u16 = __vst1_lane<uint16x8_t>;
+constexpr auto vst1q_lane_u32 = __vst1_lane<uint32x4_t>;
+constexpr auto vst1q_lane_u64 = __vst1_lane<uint64x2_t>;
 
-const auto &vst1q_lane_s8 = __vst1_lane<int8x16_t>;
-const auto &vst1q_lane_s16 = __vst1_lane<int16x8_t>;
-const auto &vst1q_lane_s32 = __vst1_lane<int32x4_t>;
-const auto &vst1q_lane_s64 = __vst1_lane<int64x2_t>;
+constexpr auto vst1q_lane_s8 = __vst1_lane<int8x16_t>;
+constexpr auto vst1q_lane_s16 = __vst1_lane<int16x8_t>;
+constexpr auto vst1q_lane_s32 = __vst1_lane<int32x4_t>;
+constexpr auto vst1q_lane_s64 = __vst1_lane<int64x2_t>;
 
-const auto &vst1q_lane_f32 = __vst1_lane<float32x4_t>;
+constexpr auto vst1q_lane_f32 = __vst1_lane<float32x4_t>;
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE void __vst(typename T::vectorType::elementType *dst, T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        sse::__vst<T, B>(dst, v);
+        return;
+    }
+#endif
+    size_t elementCount = T::lanes * T::vectorType::length;
+    for (size_t i = 0; i < elementCount; i++)
+    {
+        dst[i] = v.val[i % T::lanes].template at<typename T::vectorType::elementType>(i / T::lanes);
+    }
+}
+
+template <typename T>
+IRIS_INLINE void __vst_lane(typename T::vectorType::elementType *dst, T v, int32_t pos)
+{
+    for (size_t i = 0; i < T::lanes; i++)
+    {
+        dst[i] = v.val[i].template at<typename T::vectorType::elementType>(pos);
+    }
+}
+
+// ARM NEON - vst2 - 64-bit vectors ///////////////////////////////////////////
+constexpr auto vst2_s8 = __vst<int8x8x2_t>;
+constexpr auto vst2_s16 = __vst<int16x4x2_t>;
+constexpr auto vst2_s32 = __vst<int32x2x2_t>;
+constexpr auto vst2_s64 = __vst<int64x1x2_t>;
+
+constexpr auto vst2_u8 = __vst<uint8x8x2_t>;
+constexpr auto vst2_u16 = __vst<uint16x4x2_t>;
+constexpr auto vst2_u32 = __vst<uint32x2x2_t>;
+constexpr auto vst2_u64 = __vst<uint64x1x2_t>;
+
+constexpr auto vst2_f32 = __vst<float32x2x2_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst2 - 128-bit vectors ///////////////////////////////////////////
+constexpr auto vst2q_s8 = __vst<int8x16x2_t>;
+constexpr auto vst2q_s16 = __vst<int16x8x2_t>;
+constexpr auto vst2q_s32 = __vst<int32x4x2_t>;
+constexpr auto vst2q_s64 = __vst<int64x2x2_t>;
+
+constexpr auto vst2q_u8 = __vst<uint8x16x2_t>;
+constexpr auto vst2q_u16 = __vst<uint16x8x2_t>;
+constexpr auto vst2q_u32 = __vst<uint32x4x2_t>;
+constexpr auto vst2q_u64 = __vst<uint64x2x2_t>;
+
+constexpr auto vst2q_f32 = __vst<float32x4x2_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst2_lane - 64-bit vector //////////////////////////////////////////
+constexpr auto vst2_lane_u8 = __vst_lane<uint8x8x2_t>;
+constexpr auto vst2_lane_u16 = __vst_lane<uint16x4x2_t>;
+constexpr auto vst2_lane_u32 = __vst_lane<uint32x2x2_t>;
+
+constexpr auto vst2_lane_s8 = __vst_lane<int8x8x2_t>;
+constexpr auto vst2_lane_s16 = __vst_lane<int16x4x2_t>;
+constexpr auto vst2_lane_s32 = __vst_lane<int32x2x2_t>;
+
+constexpr auto vst2_lane_f32 = __vst_lane<float32x2x2_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst2_lane - 128-bit vector //////////////////////////////////////////
+constexpr auto vst2q_lane_u8 = __vst_lane<uint8x16x2_t>;
+constexpr auto vst2q_lane_u16 = __vst_lane<uint16x8x2_t>;
+constexpr auto vst2q_lane_u32 = __vst_lane<uint32x4x2_t>;
+
+constexpr auto vst2q_lane_s8 = __vst_lane<int8x16x2_t>;
+constexpr auto vst2q_lane_s16 = __vst_lane<int16x8x2_t>;
+constexpr auto vst2q_lane_s32 = __vst_lane<int32x4x2_t>;
+
+constexpr auto vst2q_lane_f32 = __vst_lane<float32x4x2_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst3 - 64-bit vectors ///////////////////////////////////////////
+constexpr auto vst3_s8 = __vst<int8x8x3_t>;
+constexpr auto vst3_s16 = __vst<int16x4x3_t>;
+constexpr auto vst3_s32 = __vst<int32x2x3_t>;
+constexpr auto vst3_s64 = __vst<int64x1x3_t>;
+
+constexpr auto vst3_u8 = __vst<uint8x8x3_t>;
+constexpr auto vst3_u16 = __vst<uint16x4x3_t>;
+constexpr auto vst3_u32 = __vst<uint32x2x3_t>;
+constexpr auto vst3_u64 = __vst<uint64x1x3_t>;
+
+constexpr auto vst3_f32 = __vst<float32x2x3_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst3 - 128-bit vectors ///////////////////////////////////////////
+constexpr auto vst3q_s8 = __vst<int8x16x3_t>;
+constexpr auto vst3q_s16 = __vst<int16x8x3_t>;
+constexpr auto vst3q_s32 = __vst<int32x4x3_t>;
+constexpr auto vst3q_s64 = __vst<int64x2x3_t>;
+
+constexpr auto vst3q_u8 = __vst<uint8x16x3_t>;
+constexpr auto vst3q_u16 = __vst<uint16x8x3_t>;
+constexpr auto vst3q_u32 = __vst<uint32x4x3_t>;
+constexpr auto vst3q_u64 = __vst<uint64x2x3_t>;
+
+constexpr auto vst3q_f32 = __vst<float32x4x3_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst3_lane - 64-bit vector //////////////////////////////////////////
+constexpr auto vst3_lane_u8 = __vst_lane<uint8x8x3_t>;
+constexpr auto vst3_lane_u16 = __vst_lane<uint16x4x3_t>;
+constexpr auto vst3_lane_u32 = __vst_lane<uint32x2x3_t>;
+
+constexpr auto vst3_lane_s8 = __vst_lane<int8x8x3_t>;
+constexpr auto vst3_lane_s16 = __vst_lane<int16x4x3_t>;
+constexpr auto vst3_lane_s32 = __vst_lane<int32x2x3_t>;
+
+constexpr auto vst3_lane_f32 = __vst_lane<float32x2x3_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst3_lane - 128-bit vector //////////////////////////////////////////
+constexpr auto vst3q_lane_u8 = __vst_lane<uint8x16x3_t>;
+constexpr auto vst3q_lane_u16 = __vst_lane<uint16x8x3_t>;
+constexpr auto vst3q_lane_u32 = __vst_lane<uint32x4x3_t>;
+
+constexpr auto vst3q_lane_s8 = __vst_lane<int8x16x3_t>;
+constexpr auto vst3q_lane_s16 = __vst_lane<int16x8x3_t>;
+constexpr auto vst3q_lane_s32 = __vst_lane<int32x4x3_t>;
+
+constexpr auto vst3q_lane_f32 = __vst_lane<float32x4x3_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst4 - 64-bit vectors ///////////////////////////////////////////
+constexpr auto vst4_s8 = __vst<int8x8x4_t>;
+constexpr auto vst4_s16 = __vst<int16x4x4_t>;
+constexpr auto vst4_s32 = __vst<int32x2x4_t>;
+constexpr auto vst4_s64 = __vst<int64x1x4_t>;
+
+constexpr auto vst4_u8 = __vst<uint8x8x4_t>;
+constexpr auto vst4_u16 = __vst<uint16x4x4_t>;
+constexpr auto vst4_u32 = __vst<uint32x2x4_t>;
+constexpr auto vst4_u64 = __vst<uint64x1x4_t>;
+
+constexpr auto vst4_f32 = __vst<float32x2x4_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst4 - 128-bit vectors ///////////////////////////////////////////
+constexpr auto vst4q_s8 = __vst<int8x16x4_t>;
+constexpr auto vst4q_s16 = __vst<int16x8x4_t>;
+constexpr auto vst4q_s32 = __vst<int32x4x4_t>;
+constexpr auto vst4q_s64 = __vst<int64x2x4_t>;
+
+constexpr auto vst4q_u8 = __vst<uint8x16x4_t>;
+constexpr auto vst4q_u16 = __vst<uint16x8x4_t>;
+constexpr auto vst4q_u32 = __vst<uint32x4x4_t>;
+constexpr auto vst4q_u64 = __vst<uint64x2x4_t>;
+
+constexpr auto vst4q_f32 = __vst<float32x4x4_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst4_lane - 64-bit vector //////////////////////////////////////////
+constexpr auto vst4_lane_u8 = __vst_lane<uint8x8x4_t>;
+constexpr auto vst4_lane_u16 = __vst_lane<uint16x4x4_t>;
+constexpr auto vst4_lane_u32 = __vst_lane<uint32x2x4_t>;
+
+constexpr auto vst4_lane_s8 = __vst_lane<int8x8x4_t>;
+constexpr auto vst4_lane_s16 = __vst_lane<int16x4x4_t>;
+constexpr auto vst4_lane_s32 = __vst_lane<int32x2x4_t>;
+
+constexpr auto vst4_lane_f32 = __vst_lane<float32x2x4_t>;
+/////////////////////////////////////////////////////////////////////////////
+
+// ARM NEON - vst4_lane - 128-bit vector //////////////////////////////////////////
+constexpr auto vst4q_lane_u8 = __vst_lane<uint8x16x4_t>;
+constexpr auto vst4q_lane_u16 = __vst_lane<uint16x8x4_t>;
+constexpr auto vst4q_lane_u32 = __vst_lane<uint32x4x4_t>;
+
+constexpr auto vst4q_lane_s8 = __vst_lane<int8x16x4_t>;
+constexpr auto vst4q_lane_s16 = __vst_lane<int16x8x4_t>;
+constexpr auto vst4q_lane_s32 = __vst_lane<int32x4x4_t>;
+
+constexpr auto vst4q_lane_f32 = __vst_lane<float32x4x4_t>;
+/////////////////////////////////////////////////////////////////////////////
 
 } // namespace iris::arm::store
 
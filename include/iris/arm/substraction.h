@@ -1,48 +1,76 @@
 #include "common.h"
+#include "sse/substraction.h"
+#include "gnu/substraction.h"
 #ifndef IRIS_ARM_SUBSTRACTION
 #define IRIS_ARM_SUBSTRACTION
 
 namespace iris::arm::substraction
 {
 
-template <typename T>
-T __vsub(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vsub(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vsub(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vsub(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(i) - v2.template at<typename T::elementType>(i);
+        using E = typename T::elementType;
+        using W = iris::common::wrap_lane<E>;
+        result.template at<E>(i) = static_cast<E>(static_cast<W>(v1.template at<E>(i)) - static_cast<W>(v2.template at<E>(i)));
     }
     return result;
 }
 
-const auto &vsub_u8 = __vsub<uint8x8_t>;
-const auto &vsub_u16 = __vsub<uint16x4_t>;
-const auto &vsub_u32 = __vsub<uint32x2_t>;
-const auto &vsub_u64 = __vsub<uint64x1_t>;
+constexpr auto vsub_u8 = __vsub<uint8x8_t>;
+constexpr auto vsub_u16 = __vsub<uint16x4_t>;
+constexpr auto vsub_u32 = __vsub<uint32x2_t>;
+constexpr auto vsub_u64 = __vsub<uint64x1_t>;
 
-const auto &vsub_s8 = __vsub<int8x8_t>;
-const auto &vsub_s16 = __vsub<int16x4_t>;
-const auto &vsub_s32 = __vsub<int32x2_t>;
-const auto &vsub_s64 = __vsub<int64x1_t>;
+constexpr auto vsub_s8 = __vsub<int8x8_t>;
+constexpr auto vsub_s16 = __vsub<int16x4_t>;
+constexpr auto vsub_s32 = __vsub<int32x2_t>;
+constexpr auto vsub_s64 = __vsub<int64x1_t>;
 
-const auto &vsub_f32 = __vsub<float32x2_t>;
+constexpr auto vsub_f32 = __vsub<float32x2_t>;
 
-const auto &vsubq_u8 = __vsub<uint8x16_t>;
-const auto &vsubq_u16 = __vsub<uint16x8_t>;
-const auto &vsubq_u32 = __vsub<uint32x4_t>;
-const auto &vsubq_u64 = __vsub<uint64x2_t>;
+constexpr auto vsubq_u8 = __vsub<uint8x16_t>;
+constexpr auto vsubq_u16 = __vsub<uint16x8_t>;
+constexpr auto vsubq_u32 = __vsub<uint32x4_t>;
+constexpr auto vsubq_u64 = __vsub<uint64x2_t>;
 
-const auto &vsubq_s8 = __vsub<int8x16_t>;
-const auto &vsubq_s16 = __vsub<int16x8_t>;
-const auto &vsubq_s32 = __vsub<int32x4_t>;
-const auto &vsubq_s64 = __vsub<int64x2_t>;
+constexpr auto vsubq_s8 = __vsub<int8x16_t>;
+constexpr auto vsubq_s16 = __vsub<int16x8_t>;
+constexpr auto vsubq_s32 = __vsub<int32x4_t>;
+constexpr auto vsubq_s64 = __vsub<int64x2_t>;
 
-const auto &vsubq_f32 = __vsub<float32x4_t>;
+constexpr auto vsubq_f32 = __vsub<float32x4_t>;
 
-template <typename T, typename R>
-R __vsubl(T v1, T v2)
+template <typename T, typename R, typename B = backend::best>
+IRIS_INLINE constexpr R __vsubl(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vsubl<T, R, B>(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vsubl<T, R>(v1, v2);
+    }
+#endif
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
@@ -51,17 +79,29 @@ R __vsubl(T v1, T v2)
     return result;
 }
 
-const auto &vsubl_s8 = __vsubl<int8x8_t, int16x8_t>;
-const auto &vsubl_s16 = __vsubl<int16x4_t, int32x4_t>;
-const auto &vsubl_s32 = __vsubl<int32x2_t, int64x2_t>;
+constexpr auto vsubl_s8 = __vsubl<int8x8_t, int16x8_t>;
+constexpr auto vsubl_s16 = __vsubl<int16x4_t, int32x4_t>;
+constexpr auto vsubl_s32 = __vsubl<int32x2_t, int64x2_t>;
 
-const auto &vsubl_u8 = __vsubl<uint8x8_t, uint16x8_t>;
-const auto &vsubl_u16 = __vsubl<uint16x4_t, uint32x4_t>;
-const auto &vsubl_u32 = __vsubl<uint32x2_t, uint64x2_t>;
+constexpr auto vsubl_u8 = __vsubl<uint8x8_t, uint16x8_t>;
+constexpr auto vsubl_u16 = __vsubl<uint16x4_t, uint32x4_t>;
+constexpr auto vsubl_u32 = __vsubl<uint32x2_t, uint64x2_t>;
 
-template <typename T, typename R>
-R __vsubw(R v1, T v2)
+template <typename R, typename T, typename B = backend::best>
+IRIS_INLINE constexpr R __vsubw(R v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vsubw<R, T, B>(v1, v2);
+    }
+#endif
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vsubw<R, T>(v1, v2);
+    }
+#endif
     R result;
     for (size_t i = 0; i < T::length; i++)
     {
@@ -70,85 +110,108 @@ R __vsubw(R v1, T v2)
     return result;
 }
 
-const auto &vsubw_u8 = __vsubw<uint16x8_t, uint8x8_t>;
-const auto &vsubw_u16 = __vsubw<uint32x4_t, uint16x4_t>;
-const auto &vsubw_u32 = __vsubw<uint64x2_t, uint32x2_t>;
+constexpr auto vsubw_u8 = __vsubw<uint16x8_t, uint8x8_t>;
+constexpr auto vsubw_u16 = __vsubw<uint32x4_t, uint16x4_t>;
+constexpr auto vsubw_u32 = __vsubw<uint64x2_t, uint32x2_t>;
 
-const auto &vsubw_s8 = __vsubw<int16x8_t, int8x8_t>;
-const auto &vsubw_s16 = __vsubw<int32x4_t, int16x4_t>;
-const auto &vsubw_s32 = __vsubw<int64x2_t, int32x2_t>;
+constexpr auto vsubw_s8 = __vsubw<int16x8_t, int8x8_t>;
+constexpr auto vsubw_s16 = __vsubw<int32x4_t, int16x4_t>;
+constexpr auto vsubw_s32 = __vsubw<int64x2_t, int32x2_t>;
 
-template <typename T>
-T __vhsub(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vhsub(T v1, T v2)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vhsub(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(i) - v2.template at<typename T::elementType>(i);
-        result.template at<typename T::elementType>(i) /= 2;
+        int64_t x = v1.template at<typename T::elementType>(i);
+        int64_t y = v2.template at<typename T::elementType>(i);
+        result.template at<typename T::elementType>(i) = static_cast<typename T::elementType>((x - y) >> 1);
     }
     return result;
 }
 
-const auto &vhsub_u8 = __vhsub<uint8x8_t>;
-const auto &vhsub_u16 = __vhsub<uint16x4_t>;
-const auto &vhsub_u32 = __vhsub<uint32x2_t>;
+constexpr auto vhsub_u8 = __vhsub<uint8x8_t>;
+constexpr auto vhsub_u16 = __vhsub<uint16x4_t>;
+constexpr auto vhsub_u32 = __vhsub<uint32x2_t>;
 
-const auto &vhsub_s8 = __vhsub<int16x8_t>;
-const auto &vhsub_s16 = __vhsub<int32x4_t>;
-const auto &vhsub_s32 = __vhsub<int64x2_t>;
+constexpr auto vhsub_s8 = __vhsub<int8x8_t>;
+constexpr auto vhsub_s16 = __vhsub<int16x4_t>;
+constexpr auto vhsub_s32 = __vhsub<int32x2_t>;
 
-const auto &vhsubq_u8 = __vhsub<uint8x16_t>;
-const auto &vhsubq_u16 = __vhsub<uint16x8_t>;
-const auto &vhsubq_u32 = __vhsub<uint32x4_t>;
+constexpr auto vhsubq_u8 = __vhsub<uint8x16_t>;
+constexpr auto vhsubq_u16 = __vhsub<uint16x8_t>;
+constexpr auto vhsubq_u32 = __vhsub<uint32x4_t>;
 
-const auto &vhsubq_s8 = __vhsub<int8x16_t>;
-const auto &vhsubq_s16 = __vhsub<int16x8_t>;
-const auto &vhsubq_s32 = __vhsub<int32x4_t>;
+constexpr auto vhsubq_s8 = __vhsub<int8x16_t>;
+constexpr auto vhsubq_s16 = __vhsub<int16x8_t>;
+constexpr auto vhsubq_s32 = __vhsub<int32x4_t>;
 
-template <typename T>
-T __vqsub(T v1, T v2)
+// Saturating x - y on the wrapped unsigned difference. A signed difference
+// overflows when x and y differ in sign and the result differs from x, and
+// then saturates towards the sign of x; an unsigned one when y exceeds x.
+template <typename E>
+IRIS_INLINE constexpr E __iris__qsub(E x, E y)
 {
+    using U = typename std::make_unsigned<E>::type;
+    U d = static_cast<U>(U(x) - U(y));
+    if constexpr (std::is_signed<E>::value)
+    {
+        constexpr uint32_t top = sizeof(E) * 8 - 1;
+        U m = static_cast<U>(U(0) - U(((U(x) ^ U(y)) & (U(x) ^ d)) >> top));
+        U saturated = static_cast<U>(U(U(x) >> top) + U(std::numeric_limits<E>::max()));
+        return static_cast<E>(static_cast<U>((d & ~m) | (saturated & m)));
+    }
+    else
+    {
+        return static_cast<E>(static_cast<U>(d & (U(0) - U(x >= y))));
+    }
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vqsub(T v1, T v2)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqsub(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
         auto x = v1.template at<typename T::elementType>(i);
         auto y = v2.template at<typename T::elementType>(i);
-        if ((y > 0) && (x < std::numeric_limits<typename T::elementType>::min() + y))
-        {
-            result.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::min();
-        }
-        else if ((y < 0) && (x > std::numeric_limits<typename T::elementType>::max() + y))
-        {
-            result.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
-        }
-        else
-        {
-            result.template at<typename T::elementType>(i) = x - y;
-        }
+        result.template at<typename T::elementType>(i) = __iris__qsub(x, y);
     }
     return result;
 }
 
-const auto &vqsub_u8 = __vqsub<uint8x8_t>;
-const auto &vqsub_u16 = __vqsub<uint16x4_t>;
-const auto &vqsub_u32 = __vqsub<uint32x2_t>;
-const auto &vqsub_u64 = __vqsub<uint64x1_t>;
-
-const auto &vqsub_s8 = __vqsub<int8x8_t>;
-const auto &vqsub_s16 = __vqsub<int16x4_t>;
-const auto &vqsub_s32 = __vqsub<int32x2_t>;
-const auto &vqsub_s64 = __vqsub<int64x1_t>;
-
-const auto &vqsubq_u8 = __vqsub<uint8x16_t>;
-const auto &vqsubq_u16 = __vqsub<uint16x8_t>;
-const auto &vqsubq_u32 = __vqsub<uint32x4_t>;
-const auto &vqsubq_u64 = __vqsub<uint64x2_t>;
-
-const auto &vqsubq_s8 = __vqsub<int8x16_t>;
-const auto &vqsubq_s16 = __vqsub<int16x8_t>;
-const auto &vqsubq_s32 = __vqsub<int32x4_t>;
-const auto &vqsubq_s64 = __vqsub<int64x2_t>;
+constexpr auto vqsub_u8 = __vqsub<uint8x8_t>;
+constexpr auto vqsub_u16 = __vqsub<uint16x4_t>;
+constexpr auto vqsub_u32 = __vqsub<uint32x2_t>;
+constexpr auto vqsub_u64 = __vqsub<uint64x1_t>;
+
+constexpr auto vqsub_s8 = __vqsub<int8x8_t>;
+constexpr auto vqsub_s16 = __vqsub<int16x4_t>;
+constexpr auto vqsub_s32 = __vqsub<int32x2_t>;
+constexpr auto vqsub_s64 = __vqsub<int64x1_t>;
+
+constexpr auto vqsubq_u8 = __vqsub<uint8x16_t>;
+constexpr auto vqsubq_u16 = __vqsub<uint16x8_t>;
+constexpr auto vqsubq_u32 = __vqsub<uint32x4_t>;
+constexpr auto vqsubq_u64 = __vqsub<uint64x2_t>;
+
+constexpr auto vqsubq_s8 = __vqsub<int8x16_t>;
+constexpr auto vqsubq_s16 = __vqsub<int16x8_t>;
+constexpr auto vqsubq_s32 = __vqsub<int32x4_t>;
+constexpr auto vqsubq_s64 = __vqsub<int64x2_t>;
 
 } 
 
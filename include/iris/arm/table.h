@@ -0,0 +1,130 @@
+#include "common.h"
+#include "sse/table.h"
+
+#ifndef IRIS_ARM_TABLE
+#define IRIS_ARM_TABLE
+
+namespace iris::arm::table
+{
+
+// A table is one vector or a multi_vector of them, read as consecutive bytes.
+template <typename Table>
+constexpr size_t __table_size = Table::length;
+
+template <typename V, size_t n>
+constexpr size_t __table_size<iris::common::multi_vector<V, n>> = n * V::length;
+
+template <typename E, size_t len>
+IRIS_INLINE constexpr E __table_byte(const iris::common::vector<E, len> &t, size_t j)
+{
+    return t.template at<E>(j);
+}
+
+template <typename V, size_t n>
+IRIS_INLINE constexpr typename V::elementType __table_byte(const iris::common::multi_vector<V, n> &t, size_t j)
+{
+    return t.val[j / V::length].template at<typename V::elementType>(j % V::length);
+}
+
+template <typename R, typename Table, typename I, typename B = backend::best>
+IRIS_INLINE constexpr R __vtbl(Table t, I idx)
+{
+#if IRIS_ARM_SSSE3
+    if (sse::__supports<B>(sse::tier::ssse3))
+    {
+        return sse::__vtbl<R, __table_size<Table>>(t, idx);
+    }
+#endif
+    R result;
+    for (size_t i = 0; i < R::length; i++)
+    {
+        size_t j = static_cast<uint8_t>(idx.template at<typename I::elementType>(i));
+        result.template at<typename R::elementType>(i) = j < __table_size<Table> ? __table_byte(t, j) : 0;
+    }
+    return result;
+}
+
+template <typename R, typename Table, typename I, typename B = backend::best>
+IRIS_INLINE constexpr R __vtbx(R a, Table t, I idx)
+{
+#if IRIS_ARM_SSSE3
+    if (sse::__supports<B>(sse::tier::ssse3))
+    {
+        return sse::__vtbx<R, __table_size<Table>>(a, t, idx);
+    }
+#endif
+    R result;
+    for (size_t i = 0; i < R::length; i++)
+    {
+        size_t j = static_cast<uint8_t>(idx.template at<typename I::elementType>(i));
+        result.template at<typename R::elementType>(i) = j < __table_size<Table> ? __table_byte(t, j) : a.template at<typename R::elementType>(i);
+    }
+    return result;
+}
+
+constexpr auto vtbl1_u8 = __vtbl<uint8x8_t, uint8x8_t, uint8x8_t>;
+constexpr auto vtbl2_u8 = __vtbl<uint8x8_t, uint8x8x2_t, uint8x8_t>;
+constexpr auto vtbl3_u8 = __vtbl<uint8x8_t, uint8x8x3_t, uint8x8_t>;
+constexpr auto vtbl4_u8 = __vtbl<uint8x8_t, uint8x8x4_t, uint8x8_t>;
+
+constexpr auto vtbl1_s8 = __vtbl<int8x8_t, int8x8_t, int8x8_t>;
+constexpr auto vtbl2_s8 = __vtbl<int8x8_t, int8x8x2_t, int8x8_t>;
+constexpr auto vtbl3_s8 = __vtbl<int8x8_t, int8x8x3_t, int8x8_t>;
+constexpr auto vtbl4_s8 = __vtbl<int8x8_t, int8x8x4_t, int8x8_t>;
+
+constexpr auto vtbx1_u8 = __vtbx<uint8x8_t, uint8x8_t, uint8x8_t>;
+constexpr auto vtbx2_u8 = __vtbx<uint8x8_t, uint8x8x2_t, uint8x8_t>;
+constexpr auto vtbx3_u8 = __vtbx<uint8x8_t, uint8x8x3_t, uint8x8_t>;
+constexpr auto vtbx4_u8 = __vtbx<uint8x8_t, uint8x8x4_t, uint8x8_t>;
+
+constexpr auto vtbx1_s8 = __vtbx<int8x8_t, int8x8_t, int8x8_t>;
+constexpr auto vtbx2_s8 = __vtbx<int8x8_t, int8x8x2_t, int8x8_t>;
+constexpr auto vtbx3_s8 = __vtbx<int8x8_t, int8x8x3_t, int8x8_t>;
+constexpr auto vtbx4_s8 = __vtbx<int8x8_t, int8x8x4_t, int8x8_t>;
+
+// A64 forms: 16-byte table registers and unsigned indices
+constexpr auto vqtbl1_u8 = __vtbl<uint8x8_t, uint8x16_t, uint8x8_t>;
+constexpr auto vqtbl2_u8 = __vtbl<uint8x8_t, uint8x16x2_t, uint8x8_t>;
+constexpr auto vqtbl3_u8 = __vtbl<uint8x8_t, uint8x16x3_t, uint8x8_t>;
+constexpr auto vqtbl4_u8 = __vtbl<uint8x8_t, uint8x16x4_t, uint8x8_t>;
+
+constexpr auto vqtbl1_s8 = __vtbl<int8x8_t, int8x16_t, uint8x8_t>;
+constexpr auto vqtbl2_s8 = __vtbl<int8x8_t, int8x16x2_t, uint8x8_t>;
+constexpr auto vqtbl3_s8 = __vtbl<int8x8_t, int8x16x3_t, uint8x8_t>;
+constexpr auto vqtbl4_s8 = __vtbl<int8x8_t, int8x16x4_t, uint8x8_t>;
+
+constexpr auto vqtbl1q_u8 = __vtbl<uint8x16_t, uint8x16_t, uint8x16_t>;
+constexpr auto vqtbl2q_u8 = __vtbl<uint8x16_t, uint8x16x2_t, uint8x16_t>;
+constexpr auto vqtbl3q_u8 = __vtbl<uint8x16_t, uint8x16x3_t, uint8x16_t>;
+constexpr auto vqtbl4q_u8 = __vtbl<uint8x16_t, uint8x16x4_t, uint8x16_t>;
+
+constexpr auto vqtbl1q_s8 = __vtbl<int8x16_t, int8x16_t, uint8x16_t>;
+constexpr auto vqtbl2q_s8 = __vtbl<int8x16_t, int8x16x2_t, uint8x16_t>;
+constexpr auto vqtbl3q_s8 = __vtbl<int8x16_t, int8x16x3_t, uint8x16_t>;
+constexpr auto vqtbl4q_s8 = __vtbl<int8x16_t, int8x16x4_t, uint8x16_t>;
+
+constexpr auto vqtbx1_u8 = __vtbx<uint8x8_t, uint8x16_t, uint8x8_t>;
+constexpr auto vqtbx2_u8 = __vtbx<uint8x8_t, uint8x16x2_t, uint8x8_t>;
+constexpr auto vqtbx3_u8 = __vtbx<uint8x8_t, uint8x16x3_t, uint8x8_t>;
+constexpr auto vqtbx4_u8 = __vtbx<uint8x8_t, uint8x16x4_t, uint8x8_t>;
+
+constexpr auto vqtbx1_s8 = __vtbx<int8x8_t, int8x16_t, uint8x8_t>;
+constexpr auto vqtbx2_s8 = __vtbx<int8x8_t, int8x16x2_t, uint8x8_t>;
+constexpr auto vqtbx3_s8 = __vtbx<int8x8_t, int8x16x3_t, uint8x8_t>;
+constexpr auto vqtbx4_s8 = __vtbx<int8x8_t, int8x16x4_t, uint8x8_t>;
+
+constexpr auto vqtbx1q_u8 = __vtbx<uint8x16_t, uint8x16_t, uint8x16_t>;
+constexpr auto vqtbx2q_u8 = __vtbx<uint8x16_t, uint8x16x2_t, uint8x16_t>;
+constexpr auto vqtbx3q_u8 = __vtbx<uint8x16_t, uint8x16x3_t, uint8x16_t>;
+constexpr auto vqtbx4q_u8 = __vtbx<uint8x16_t, uint8x16x4_t, uint8x16_t>;
+
+constexpr auto vqtbx1q_s8 = __vtbx<int8x16_t, int8x16_t, uint8x16_t>;
+constexpr auto vqtbx2q_s8 = __vtbx<int8x16_t, int8x16x2_t, uint8x16_t>;
+constexpr auto vqtbx3q_s8 = __vtbx<int8x16_t, int8x16x3_t, uint8x16_t>;
+constexpr auto vqtbx4q_s8 = __vtbx<int8x16_t, int8x16x4_t, uint8x16_t>;
+
+} // namespace iris::arm::table
+
+using namespace iris::arm::table;
+
+#endif
@@ -1,4 +1,5 @@
 #include "common.h"
+#include "sse/utility.h"
 
 #ifndef IRIS_ARM_UTILITY
 #define IRIS_ARM_UTILITY
@@ -6,9 +7,15 @@
 namespace iris::arm::utility
 {
 
-template <typename T>
-T __vrev64(typename std::enable_if<sizeof(typename T::elementType) < 8, T>::type v)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vrev64(typename std::enable_if<sizeof(typename T::elementType) < 8, T>::type v)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vrev64<T, B>(v);
+    }
+#endif
     T result;
     const size_t packs = (T::length * sizeof(typename T::elementType)) / 8;
     const size_t elementsPerPack = T::length / packs;
@@ -22,29 +29,35 @@ T __vrev64(typename std::enable_if<sizeof(typename T::elementType) < 8, T>::type
     return result;
 }
 
-const auto &vrev64_s8 = __vrev64<int8x8_t>;
-const auto &vrev64_s16 = __vrev64<int16x4_t>;
-const auto &vrev64_s32 = __vrev64<int32x2_t>;
+constexpr auto vrev64_s8 = __vrev64<int8x8_t>;
+constexpr auto vrev64_s16 = __vrev64<int16x4_t>;
+constexpr auto vrev64_s32 = __vrev64<int32x2_t>;
 
-const auto &vrev64_u8 = __vrev64<uint8x8_t>;
-const auto &vrev64_u16 = __vrev64<uint16x4_t>;
-const auto &vrev64_u32 = __vrev64<uint32x2_t>;
+constexpr auto vrev64_u8 = __vrev64<uint8x8_t>;
+constexpr auto vrev64_u16 = __vrev64<uint16x4_t>;
+constexpr auto vrev64_u32 = __vrev64<uint32x2_t>;
 
-const auto &vrev64_f32 = __vrev64<float32x2_t>;
+constexpr auto vrev64_f32 = __vrev64<float32x2_t>;
 
-const auto &vrev64q_s8 = __vrev64<int8x16_t>;
-const auto &vrev64q_s16 = __vrev64<int16x8_t>;
-const auto &vrev64q_s32 = __vrev64<int32x4_t>;
+constexpr auto vrev64q_s8 = __vrev64<int8x16_t>;
+constexpr auto vrev64q_s16 = __vrev64<int16x8_t>;
+constexpr auto vrev64q_s32 = __vrev64<int32x4_t>;
 
-const auto &vrev64q_u8 = __vrev64<uint8x16_t>;
-const auto &vrev64q_u16 = __vrev64<uint16x8_t>;
-const auto &vrev64q_u32 = __vrev64<uint32x4_t>;
+constexpr auto vrev64q_u8 = __vrev64<uint8x16_t>;
+constexpr auto vrev64q_u16 = __vrev64<uint16x8_t>;
+constexpr auto vrev64q_u32 = __vrev64<uint32x4_t>;
 
-const auto &vrev64q_f32 = __vrev64<float32x4_t>;
+constexpr auto vrev64q_f32 = __vrev64<float32x4_t>;
 
-template <typename T>
-T __vrev32(typename std::enable_if<sizeof(typename T::elementType) < 4, T>::type v)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vrev32(typename std::enable_if<sizeof(typename T::elementType) < 4, T>::type v)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vrev32<T, B>(v);
+    }
+#endif
     T result;
     const size_t packs = (T::length * sizeof(typename T::elementType)) / 4;
     const size_t elementsPerPack = T::length / packs;
@@ -58,20 +71,26 @@ T __vrev32(typename std::enable_if<sizeof(typename T::elementType) < 4, T>::type
     return result;
 }
 
-const auto &vrev32_s8 = __vrev32<int8x8_t>;
-const auto &vrev32_s16 = __vrev32<int16x4_t>;
+constexpr auto vrev32_s8 = __vrev32<int8x8_t>;
+constexpr auto vrev32_s16 = __vrev32<int16x4_t>;
 
-const auto &vrev32_u8 = __vrev32<uint8x8_t>;
-const auto &vrev32_u16 = __vrev32<uint16x4_t>;
-const auto &vrev32q_s8 = __vrev32<int8x16_t>;
-const auto &vrev32q_s16 = __vrev32<int16x8_t>;
+constexpr auto vrev32_u8 = __vrev32<uint8x8_t>;
+constexpr auto vrev32_u16 = __vrev32<uint16x4_t>;
+constexpr auto vrev32q_s8 = __vrev32<int8x16_t>;
+constexpr auto vrev32q_s16 = __vrev32<int16x8_t>;
 
-const auto &vrev32q_u8 = __vrev32<uint8x16_t>;
-const auto &vrev32q_u16 = __vrev32<uint16x8_t>;
+constexpr auto vrev32q_u8 = __vrev32<uint8x16_t>;
+constexpr auto vrev32q_u16 = __vrev32<uint16x8_t>;
 
-template <typename T>
-T __vrev16(typename std::enable_if<sizeof(typename T::elementType) < 2, T>::type v)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vrev16(typename std::enable_if<sizeof(typename T::elementType) < 2, T>::type v)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vrev16<T, B>(v);
+    }
+#endif
     T result;
     const size_t packs = (T::length * sizeof(typename T::elementType)) / 2;
     const size_t elementsPerPack = T::length / packs;
@@ -85,46 +104,78 @@ T __vrev16(typename std::enable_if<sizeof(typename T::elementType) < 2, T>::type
     return result;
 }
 
-const auto &vrev16_s8 = __vrev16<int8x8_t>;
-const auto &vrev16_u8 = __vrev16<uint8x8_t>;
+constexpr auto vrev16_s8 = __vrev16<int8x8_t>;
+constexpr auto vrev16_u8 = __vrev16<uint8x8_t>;
 
-const auto &vrev16q_s8 = __vrev16<int8x16_t>;
-const auto &vrev16q_u8 = __vrev16<uint8x16_t>;
+constexpr auto vrev16q_s8 = __vrev16<int8x16_t>;
+constexpr auto vrev16q_u8 = __vrev16<uint8x16_t>;
 
-template <typename T>
-T __vext(T v1, T v2, int32_t n)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vext(T v1, T v2, int32_t n)
 {
-    T result;
-    for (int32_t i = 0; i <= n; i++)
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
     {
-        result.template at<typename T::elementType>(i) = v2.template at<typename T::elementType>(i);
+        return sse::__vext<T, B>(v1, v2, n);
     }
-    for (int32_t i = n + 1, j = T::length - 1; (size_t)i < T::length; i++, j--)
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(j);
+        size_t j = i + n;
+        result.template at<typename T::elementType>(i) = j < T::length ? v1.template at<typename T::elementType>(j) : v2.template at<typename T::elementType>(j - T::length);
     }
     return result;
 }
 
-const auto &vext_s8 = __vext<int8x8_t>;
-const auto &vext_s16 = __vext<int16x4_t>;
-const auto &vext_s32 = __vext<int32x2_t>;
-const auto &vext_s64 = __vext<int64x1_t>;
-
-const auto &vext_u8 = __vext<uint8x8_t>;
-const auto &vext_u16 = __vext<uint16x4_t>;
-const auto &vext_u32 = __vext<uint32x2_t>;
-const auto &vext_u64 = __vext<uint64x1_t>;
-
-const auto &vextq_s8 = __vext<int8x16_t>;
-const auto &vextq_s16 = __vext<int16x8_t>;
-const auto &vextq_s32 = __vext<int32x4_t>;
-const auto &vextq_s64 = __vext<int64x2_t>;
-
-const auto &vextq_u8 = __vext<uint8x16_t>;
-const auto &vextq_u16 = __vext<uint16x8_t>;
-const auto &vextq_u32 = __vext<uint32x4_t>;
-const auto &vextq_u64 = __vext<uint64x2_t>;
+// lane index as a template argument: one shift or palignr per index
+template <size_t n, typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vext(T v1, T v2)
+{
+    static_assert(n < T::length, "vext lane out of range");
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vext<n, T, B>(v1, v2);
+    }
+#endif
+    return __vext<T, backend::scalar>(v1, v2, n);
+}
+
+constexpr auto vext_s8 = __vext<int8x8_t>;
+constexpr auto vext_s16 = __vext<int16x4_t>;
+constexpr auto vext_s32 = __vext<int32x2_t>;
+constexpr auto vext_s64 = __vext<int64x1_t>;
+
+constexpr auto vext_u8 = __vext<uint8x8_t>;
+constexpr auto vext_u16 = __vext<uint16x4_t>;
+constexpr auto vext_u32 = __vext<uint32x2_t>;
+constexpr auto vext_u64 = __vext<uint64x1_t>;
+
+constexpr auto vextq_s8 = __vext<int8x16_t>;
+constexpr auto vextq_s16 = __vext<int16x8_t>;
+constexpr auto vextq_s32 = __vext<int32x4_t>;
+constexpr auto vextq_s64 = __vext<int64x2_t>;
+
+constexpr auto vextq_u8 = __vext<uint8x16_t>;
+constexpr auto vextq_u16 = __vext<uint16x8_t>;
+constexpr auto vextq_u32 = __vext<uint32x4_t>;
+constexpr auto vextq_u64 = __vext<uint64x2_t>;
+
+// Template-immediate forms, e.g. vextq<3>(v1, v2).
+template <size_t n, typename T>
+IRIS_INLINE constexpr T vext(T v1, T v2)
+{
+    static_assert(T::byteSize == 8, "vext takes 64-bit vectors");
+    return __vext<n, T>(v1, v2);
+}
+
+template <size_t n, typename T>
+IRIS_INLINE constexpr T vextq(T v1, T v2)
+{
+    static_assert(T::byteSize == 16, "vextq takes 128-bit vectors");
+    return __vext<n, T>(v1, v2);
+}
 
 } // namespace iris::arm::utility
 
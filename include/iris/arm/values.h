@@ -1,4 +1,8 @@
 #include "common.h"
+#include "estimate.h"
+#include "sse/values.h"
+#include "sse/fma.h"
+#include "gnu/values.h"
 #include <cmath>
 
 #ifndef IRIS_ARM_VALUES
@@ -6,77 +10,117 @@
 
 namespace iris::arm::values
 {
-template <typename T>
-T __vneg(T v)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vneg(T v)
 {
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vneg(v);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        typename T::elementType x = v.template at<typename T::elementType>(i);
-        result.template at<typename T::elementType>(i) = -x;
+        using E = typename T::elementType;
+        E x = v.template at<E>(i);
+        result.template at<E>(i) = static_cast<E>(-static_cast<iris::common::wrap_lane<E>>(x));
     }
     return result;
 }
 
-const auto &vneg_s8 = __vneg<int8x8_t>;
-const auto &vneg_s16 = __vneg<int16x4_t>;
-const auto &vneg_s32 = __vneg<int32x2_t>;
-const auto &vneg_f32 = __vneg<float32x2_t>;
+constexpr auto vneg_s8 = __vneg<int8x8_t>;
+constexpr auto vneg_s16 = __vneg<int16x4_t>;
+constexpr auto vneg_s32 = __vneg<int32x2_t>;
+constexpr auto vneg_f32 = __vneg<float32x2_t>;
+
+constexpr auto vnegq_s8 = __vneg<int8x16_t>;
+constexpr auto vnegq_s16 = __vneg<int16x8_t>;
+constexpr auto vnegq_s32 = __vneg<int32x4_t>;
+constexpr auto vnegq_f32 = __vneg<float32x4_t>;
+
+// Lane helpers work on the unsigned lane type, where wraparound is defined,
+// and select with all-ones masks instead of branching, so the scalar loops
+// keep a fixed cost per lane and stay vectorizable.
+template <typename E>
+IRIS_INLINE constexpr typename std::make_unsigned<E>::type __iris__mask(bool c)
+{
+    using U = typename std::make_unsigned<E>::type;
+    return static_cast<U>(U(0) - U(c));
+}
 
-const auto &vnegq_s8 = __vneg<int8x16_t>;
-const auto &vnegq_s16 = __vneg<int16x8_t>;
-const auto &vnegq_s32 = __vneg<int32x4_t>;
-const auto &vnegq_f32 = __vneg<float32x4_t>;
+template <typename E>
+IRIS_INLINE constexpr E __iris__select(bool c, E x, E y)
+{
+    if constexpr (std::is_integral<E>::value)
+    {
+        using U = typename std::make_unsigned<E>::type;
+        U m = __iris__mask<E>(c);
+        return static_cast<E>(static_cast<U>((U(x) & m) | (U(y) & ~m)));
+    }
+    else
+    {
+        return c ? x : y;
+    }
+}
 
-template <typename T>
-T __vqneg(T v)
+// -x, with the minimum going to the maximum: only -min keeps the sign bit
+// of x, and subtracting that bit turns 0x80... into 0x7f...
+template <typename E>
+IRIS_INLINE constexpr E __iris__qneg(E x)
 {
+    using U = typename std::make_unsigned<E>::type;
+    constexpr uint32_t top = sizeof(E) * 8 - 1;
+    U n = static_cast<U>(U(0) - U(x));
+    return static_cast<E>(static_cast<U>(n - U((U(x) & n) >> top)));
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vqneg(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqneg(v);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
         typename T::elementType x = v.template at<typename T::elementType>(i);
-        if (x == std::numeric_limits<typename T::elementType>::min())
-        {
-            x = -std::numeric_limits<typename T::elementType>::max();
-        }
-        else
-        {
-            x = -x;
-        }
+        x = __iris__qneg(x);
         result.template at<typename T::elementType>(i) = x;
     }
     return result;
 }
 
-const auto &vqneg_s8 = __vqneg<int8x8_t>;
-const auto &vqneg_s16 = __vqneg<int16x4_t>;
-const auto &vqneg_s32 = __vqneg<int32x2_t>;
+constexpr auto vqneg_s8 = __vqneg<int8x8_t>;
+constexpr auto vqneg_s16 = __vqneg<int16x4_t>;
+constexpr auto vqneg_s32 = __vqneg<int32x2_t>;
 
-const auto &vqnegq_s8 = __vqneg<int8x16_t>;
-const auto &vqnegq_s16 = __vqneg<int16x8_t>;
-const auto &vqnegq_s32 = __vqneg<int32x4_t>;
+constexpr auto vqnegq_s8 = __vqneg<int8x16_t>;
+constexpr auto vqnegq_s16 = __vqneg<int16x8_t>;
+constexpr auto vqnegq_s32 = __vqneg<int32x4_t>;
 
+// (x ^ m) - m with m all ones for negative x; the minimum wraps to itself
+// as it does on NEON
 template <typename T>
-T __iris__abs(T x)
+IRIS_INLINE constexpr T __iris__abs(T x)
 {
-    if (x < 0)
-    {
-        return x * static_cast<T>(-1);
-    }
-    else
-    {
-        return x;
-    }
+    using U = typename std::make_unsigned<T>::type;
+    constexpr uint32_t top = sizeof(T) * 8 - 1;
+    U m = static_cast<U>(U(0) - U(U(x) >> top));
+    return static_cast<T>(static_cast<U>((U(x) ^ m) - m));
 }
 
 template <>
-float __iris__abs(float x)
+IRIS_INLINE constexpr float __iris__abs(float x)
 {
     return std::fabs(x);
 }
 
 template <typename T>
-T __vabs(T v)
+IRIS_INLINE constexpr T __vabs(T v)
 {
     T result;
     for (size_t i = 0; i < T::length; i++)
@@ -87,102 +131,121 @@ T __vabs(T v)
     return result;
 }
 
+// |x|, with the minimum, the only lane whose abs keeps the sign bit, going
+// to the maximum
 template <typename T>
-T __iris__qabs(T x)
+IRIS_INLINE constexpr T __iris__qabs(T x)
 {
-    if (x < 0)
+    if constexpr (std::is_integral<T>::value)
     {
-        T temp = x * static_cast<T>(-1);
-        if (temp > x)
-        {
-            return temp;
-        }
-        else
-        {
-            return std::numeric_limits<T>::max();
-        }
+        using U = typename std::make_unsigned<T>::type;
+        constexpr uint32_t top = sizeof(T) * 8 - 1;
+        U a = static_cast<U>(__iris__abs(x));
+        return static_cast<T>(static_cast<U>(a - U(a >> top)));
     }
     else
     {
-        return x;
+        return __iris__abs(x);
     }
 }
 
-const auto &vabs_s8 = __vabs<int8x8_t>;
-const auto &vabs_s16 = __vabs<int16x4_t>;
-const auto &vabs_s32 = __vabs<int32x2_t>;
-const auto &vabs_f32 = __vabs<float32x2_t>;
+constexpr auto vabs_s8 = __vabs<int8x8_t>;
+constexpr auto vabs_s16 = __vabs<int16x4_t>;
+constexpr auto vabs_s32 = __vabs<int32x2_t>;
+constexpr auto vabs_f32 = __vabs<float32x2_t>;
 
-const auto &vabsq_s8 = __vabs<int8x16_t>;
-const auto &vabsq_s16 = __vabs<int16x8_t>;
-const auto &vabsq_s32 = __vabs<int32x4_t>;
-const auto &vabsq_f32 = __vabs<float32x4_t>;
+constexpr auto vabsq_s8 = __vabs<int8x16_t>;
+constexpr auto vabsq_s16 = __vabs<int16x8_t>;
+constexpr auto vabsq_s32 = __vabs<int32x4_t>;
+constexpr auto vabsq_f32 = __vabs<float32x4_t>;
 
-template <typename T>
-T __vmax(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vmax(T v1, T v2)
 {
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vmax(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(i) > v2.template at<typename T::elementType>(i) ? v1.template at<typename T::elementType>(i) : v2.template at<typename T::elementType>(i);
+        typename T::elementType x = v1.template at<typename T::elementType>(i);
+        typename T::elementType y = v2.template at<typename T::elementType>(i);
+        result.template at<typename T::elementType>(i) = __iris__select(x > y, x, y);
     }
     return result;
 }
 
-const auto &vmax_u8 = __vmax<uint8x8_t>;
-const auto &vmax_u16 = __vmax<uint16x4_t>;
-const auto &vmax_u32 = __vmax<uint32x2_t>;
+constexpr auto vmax_u8 = __vmax<uint8x8_t>;
+constexpr auto vmax_u16 = __vmax<uint16x4_t>;
+constexpr auto vmax_u32 = __vmax<uint32x2_t>;
 
-const auto &vmax_s8 = __vmax<int8x8_t>;
-const auto &vmax_s16 = __vmax<int16x4_t>;
-const auto &vmax_s32 = __vmax<int32x2_t>;
+constexpr auto vmax_s8 = __vmax<int8x8_t>;
+constexpr auto vmax_s16 = __vmax<int16x4_t>;
+constexpr auto vmax_s32 = __vmax<int32x2_t>;
 
-const auto &vmax_f32 = __vmax<float32x2_t>;
+constexpr auto vmax_f32 = __vmax<float32x2_t>;
 
-const auto &vmaxq_u8 = __vmax<uint8x16_t>;
-const auto &vmaxq_u16 = __vmax<uint16x8_t>;
-const auto &vmaxq_u32 = __vmax<uint32x4_t>;
+constexpr auto vmaxq_u8 = __vmax<uint8x16_t>;
+constexpr auto vmaxq_u16 = __vmax<uint16x8_t>;
+constexpr auto vmaxq_u32 = __vmax<uint32x4_t>;
 
-const auto &vmaxq_s8 = __vmax<int8x16_t>;
-const auto &vmaxq_s16 = __vmax<int16x8_t>;
-const auto &vmaxq_s32 = __vmax<int32x4_t>;
+constexpr auto vmaxq_s8 = __vmax<int8x16_t>;
+constexpr auto vmaxq_s16 = __vmax<int16x8_t>;
+constexpr auto vmaxq_s32 = __vmax<int32x4_t>;
 
-const auto &vmaxq_f32 = __vmax<float32x4_t>;
+constexpr auto vmaxq_f32 = __vmax<float32x4_t>;
 
-template <typename T>
-T __vmin(T v1, T v2)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vmin(T v1, T v2)
 {
+#if IRIS_ARM_GNU
+    if (gnu::__supports<B>())
+    {
+        return gnu::__vmin(v1, v2);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
-        result.template at<typename T::elementType>(i) = v1.template at<typename T::elementType>(i) < v2.template at<typename T::elementType>(i) ? v1.template at<typename T::elementType>(i) : v2.template at<typename T::elementType>(i);
+        typename T::elementType x = v1.template at<typename T::elementType>(i);
+        typename T::elementType y = v2.template at<typename T::elementType>(i);
+        result.template at<typename T::elementType>(i) = __iris__select(x < y, x, y);
     }
     return result;
 }
 
-const auto &vmin_u8 = __vmin<uint8x8_t>;
-const auto &vmin_u16 = __vmin<uint16x4_t>;
-const auto &vmin_u32 = __vmin<uint32x2_t>;
+constexpr auto vmin_u8 = __vmin<uint8x8_t>;
+constexpr auto vmin_u16 = __vmin<uint16x4_t>;
+constexpr auto vmin_u32 = __vmin<uint32x2_t>;
 
-const auto &vmin_s8 = __vmin<int8x8_t>;
-const auto &vmin_s16 = __vmin<int16x4_t>;
-const auto &vmin_s32 = __vmin<int32x2_t>;
+constexpr auto vmin_s8 = __vmin<int8x8_t>;
+constexpr auto vmin_s16 = __vmin<int16x4_t>;
+constexpr auto vmin_s32 = __vmin<int32x2_t>;
 
-const auto &vmin_f32 = __vmin<float32x2_t>;
+constexpr auto vmin_f32 = __vmin<float32x2_t>;
 
-const auto &vminq_u8 = __vmin<uint8x16_t>;
-const auto &vminq_u16 = __vmin<uint16x8_t>;
-const auto &vminq_u32 = __vmin<uint32x4_t>;
+constexpr auto vminq_u8 = __vmin<uint8x16_t>;
+constexpr auto vminq_u16 = __vmin<uint16x8_t>;
+constexpr auto vminq_u32 = __vmin<uint32x4_t>;
 
-const auto &vminq_s8 = __vmin<int8x16_t>;
-const auto &vminq_s16 = __vmin<int16x8_t>;
-const auto &vminq_s32 = __vmin<int32x4_t>;
+constexpr auto vminq_s8 = __vmin<int8x16_t>;
+constexpr auto vminq_s16 = __vmin<int16x8_t>;
+constexpr auto vminq_s32 = __vmin<int32x4_t>;
 
-const auto &vminq_f32 = __vmin<float32x4_t>;
+constexpr auto vminq_f32 = __vmin<float32x4_t>;
 
-template <typename T>
-T __vqabs(T v)
+template <typename T, typename B = backend::best>
+IRIS_INLINE constexpr T __vqabs(T v)
 {
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vqabs(v);
+    }
+#endif
     T result;
     for (size_t i = 0; i < T::length; i++)
     {
@@ -192,15 +255,104 @@ T __vqabs(T v)
     return result;
 }
 
-const auto &vqabs_s8 = __vqabs<int8x8_t>;
-const auto &vqabs_s16 = __vqabs<int16x4_t>;
-const auto &vqabs_s32 = __vqabs<int32x2_t>;
-const auto &vqabs_f32 = __vqabs<float32x2_t>;
+constexpr auto vqabs_s8 = __vqabs<int8x8_t>;
+constexpr auto vqabs_s16 = __vqabs<int16x4_t>;
+constexpr auto vqabs_s32 = __vqabs<int32x2_t>;
+constexpr auto vqabs_f32 = __vqabs<float32x2_t>;
+
+constexpr auto vqabsq_s8 = __vqabs<int8x16_t>;
+constexpr auto vqabsq_s16 = __vqabs<int16x8_t>;
+constexpr auto vqabsq_s32 = __vqabs<int32x4_t>;
+constexpr auto vqabsq_f32 = __vqabs<float32x4_t>;
+
+// Estimates bit-exact with Arm cores: float lanes follow FRECPE/FRSQRTE and
+// unsigned lanes URECPE/URSQRTE, through the same 256- and 384-entry tables.
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vrecpe(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vrecpe<T, B>(v);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        using E = typename T::elementType;
+        uint32_t x = estimate::__bits(v.template at<E>(i));
+        result.template at<E>(i) = estimate::__lane<E>(std::is_floating_point<E>::value ? estimate::__recpe(x) : estimate::__urecpe(x));
+    }
+    return result;
+}
+
+constexpr auto vrecpe_f32 = __vrecpe<float32x2_t>;
+constexpr auto vrecpe_u32 = __vrecpe<uint32x2_t>;
+
+constexpr auto vrecpeq_f32 = __vrecpe<float32x4_t>;
+constexpr auto vrecpeq_u32 = __vrecpe<uint32x4_t>;
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vrsqrte(T v)
+{
+#if IRIS_ARM_SSE2
+    if (sse::__supports<B>(sse::tier::sse2))
+    {
+        return sse::__vrsqrte<T, B>(v);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        using E = typename T::elementType;
+        uint32_t x = estimate::__bits(v.template at<E>(i));
+        result.template at<E>(i) = estimate::__lane<E>(std::is_floating_point<E>::value ? estimate::__rsqrte(x) : estimate::__ursqrte(x));
+    }
+    return result;
+}
+
+constexpr auto vrsqrte_f32 = __vrsqrte<float32x2_t>;
+constexpr auto vrsqrte_u32 = __vrsqrte<uint32x2_t>;
+
+constexpr auto vrsqrteq_f32 = __vrsqrte<float32x4_t>;
+constexpr auto vrsqrteq_u32 = __vrsqrte<uint32x4_t>;
+
+// Newton-Raphson steps: vrecps gives 2 - a * b and vrsqrts (3 - a * b) / 2,
+// each fused with one rounding.
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vstep(T v1, T v2, float constant, float half)
+{
+#if IRIS_ARM_FMA3
+    if (sse::__supports<B>(sse::tier::avx2))
+    {
+        return sse::__vstep(v1, v2, constant, half);
+    }
+#endif
+    T result;
+    for (size_t i = 0; i < T::length; i++)
+    {
+        result.template at<float>(i) = estimate::__step(v1.template at<float>(i), v2.template at<float>(i), constant, half);
+    }
+    return result;
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vrecps(T v1, T v2)
+{
+    return __vstep<T, B>(v1, v2, 2.0f, 1.0f);
+}
+
+template <typename T, typename B = backend::best>
+IRIS_INLINE T __vrsqrts(T v1, T v2)
+{
+    return __vstep<T, B>(v1, v2, 3.0f, 0.5f);
+}
+
+constexpr auto vrecps_f32 = __vrecps<float32x2_t>;
+constexpr auto vrsqrts_f32 = __vrsqrts<float32x2_t>;
 
-const auto &vqabsq_s8 = __vqabs<int8x16_t>;
-const auto &vqabsq_s16 = __vqabs<int16x8_t>;
-const auto &vqabsq_s32 = __vqabs<int32x4_t>;
-const auto &vqabsq_f32 = __vqabs<float32x4_t>;
+constexpr auto vrecpsq_f32 = __vrecps<float32x4_t>;
+constexpr auto vrsqrtsq_f32 = __vrsqrts<float32x4_t>;
 
 } // namespace iris::arm::values
 
@@ -1,20 +1,31 @@
-#ifndef IRIS_ARM_NEON
-#define IRIS_ARM_NEON
+#ifndef IRIS_ARM_NEON_HEADER
+#define IRIS_ARM_NEON_HEADER
 
+// On hosts with NEON the intrinsics and vector types come straight from the
+// compiler's <arm_neon.h>; define IRIS_ARM_EMULATE to use the emulation anyway.
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(IRIS_ARM_EMULATE)
+#define IRIS_ARM_NATIVE 1
+#include <arm_neon.h>
+#else
+#define IRIS_ARM_NATIVE 0
 #include "arm/addition.h"
 #include "arm/substraction.h"
 #include "arm/comparison.h"
 #include "arm/load.h"
 #include "arm/elements.h"
 #include "arm/utility.h"
+#include "arm/table.h"
 #include "arm/conversion.h"
 #include "arm/multiplication.h"
 #include "arm/multiplication_addition.h"
 #include "arm/fma.h"
 #include "arm/multiplication_substraction.h"
 #include "arm/bitwise.h"
+#include "arm/bitcount.h"
 #include "arm/values.h"
 #include "arm/shift.h"
 #include "arm/store.h"
+#include "arm/lazy.h"
+#endif
 
-#endif
\ No newline at end of file
+#endif
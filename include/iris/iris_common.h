@@ -1,44 +1,141 @@
 #include <cstdlib>
+#include <cstdint>
+#include <type_traits>
 
 #ifndef IRIS_COMMON
 #define IRIS_COMMON
 
+// Opt-in register-backed storage: 64-bit and 128-bit vectors are kept in a
+// 16-byte aligned union with __m128i/__m128, so they are passed in XMM registers.
+#if defined(IRIS_SSE_STORAGE) && !(defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#error "IRIS_SSE_STORAGE requires a host with SSE2"
+#endif
+
+#ifdef IRIS_SSE_STORAGE
+#include <emmintrin.h>
+#endif
+
+// True while the compiler evaluates a constant expression; the SIMD kernels
+// step aside then and the per-lane templates compute the result.
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define IRIS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define IRIS_CONSTANT_EVALUATED() false
+#endif
+
+// Lanes viewed as another element type are exempt from type-based alias
+// analysis, so those reads and writes are not reordered against the typed ones.
+#if defined(__GNUC__) || defined(__clang__)
+#define IRIS_MAY_ALIAS __attribute__((__may_alias__))
+#else
+#define IRIS_MAY_ALIAS
+#endif
+
+// Inlined at every call, also in unoptimised builds. Optimising GCC gets a
+// plain inline: at -O1 it rejects always_inline callees that it only resolves
+// from a function pointer after early inlining, and -Og defines the same
+// macros as -O1.
+#if defined(__clang__) || (defined(__GNUC__) && !defined(__OPTIMIZE__))
+#define IRIS_INLINE __attribute__((__always_inline__)) inline
+#elif defined(__GNUC__)
+#define IRIS_INLINE inline
+#elif defined(_MSC_VER)
+#define IRIS_INLINE __forceinline
+#else
+#define IRIS_INLINE inline
+#endif
+
+// Backend kernels and their helpers sit below the entry points and are never
+// called through a function pointer, so they are inlined at every level, -Og
+// included, and a call to an entry point leaves no call behind.
+#if defined(__GNUC__) || defined(__clang__)
+#define IRIS_FORCE_INLINE __attribute__((__always_inline__)) inline
+#elif defined(_MSC_VER)
+#define IRIS_FORCE_INLINE __forceinline
+#else
+#define IRIS_FORCE_INLINE inline
+#endif
+
 namespace iris::common {
 
+    template<typename E>
+    struct lane_alias {
+        typedef E IRIS_MAY_ALIAS type;
+    };
+
+    // Integer lanes are computed modulo 2^bits in an unsigned type at least as
+    // wide as int, so sums, products and left shifts wrap as on NEON instead of
+    // overflowing (after promotion, for the narrow lanes); the value is
+    // truncated to the lane type on store.
+    template<typename E>
+    using wrap_lane = typename std::conditional<std::is_integral<E>::value, std::make_unsigned<decltype(E() + 0u)>, std::common_type<E>>::type::type;
+
+    // Lanes are stored with their own type (zero-initialised) so that vectors
+    // are literal types and their lanes can be read in constant expressions.
+    template<typename T, size_t len, typename = void>
+    struct storage {
+        T value[len] = {};
+    };
+
+#ifdef IRIS_SSE_STORAGE
+    template<typename T, size_t len>
+    struct alignas(16) storage<T, len, typename std::enable_if<sizeof(T) * len == 8 || sizeof(T) * len == 16>::type> {
+        union {
+            T value[len];
+            __m128i value_m128i;
+            ::__m128 value_m128;
+        };
+
+        constexpr storage() : value{} {}
+    };
+#endif
+
     template<typename T, size_t len>
-    struct vector {
+    struct vector : storage<T, len> {
         using elementType = T;
         const static auto elementSize = sizeof(T) * 8;
         const static auto length = len;
+        const static auto byteSize = sizeof(T) * length;
 
-        int8_t value_s8[sizeof(T) * length];
+        template<typename E = T>
+        IRIS_INLINE constexpr decltype(auto) at(size_t i) {
+            if constexpr (std::is_same<E, T>::value) {
+                return this->value[i];
+            } else {
+                return reinterpret_cast<typename lane_alias<E>::type*>(&this->value)[i];
+            }
+        }
 
         template<typename E = T>
-        E& at(size_t i) {
-            return reinterpret_cast<E*>(&value_s8)[i];
+        IRIS_INLINE constexpr decltype(auto) at(size_t i) const {
+            if constexpr (std::is_same<E, T>::value) {
+                return this->value[i];
+            } else {
+                return reinterpret_cast<const typename lane_alias<E>::type*>(&this->value)[i];
+            }
         }
 
-        void setAll(T element) {
+        IRIS_INLINE constexpr void setAll(T element) {
             for (size_t i = 0; i < length; i++) {
                 at<T>(i) = element;
             }
         }
 
-        vector<T, len> add(vector<T, len>& other) {
+        IRIS_INLINE constexpr vector<T, len> add(vector<T, len>& other) {
             vector<T, len> result;
             for(size_t i = 0; i < length; i++) {
-                result.at(i) = at(i) + other.at(i);
+                result.at(i) = static_cast<T>(static_cast<wrap_lane<T>>(at(i)) + static_cast<wrap_lane<T>>(other.at(i)));
             }
             return result;
         }
 
         template<typename R>
-        vector<R, len> add_wider(vector<T, len>& other) {
+        IRIS_INLINE constexpr vector<R, len> add_wider(vector<T, len>& other) {
             vector<R, len> result;
             for(size_t i = 0; i < length; i++) {
                 R x = static_cast<R>(at(i));
                 R y = static_cast<R>(other.at(i));
-                result.at(i) = x + y; 
+                result.at(i) = x + y;
             }
             return result;
         }
@@ -51,7 +148,7 @@ namespace iris::common {
         using vectorType = T;
         const static auto lanes = len;
         T val[lanes];
-    }; 
+    };
 
 }
-#endif
\ No newline at end of file
+#endif
@@ -27,7 +27,7 @@ template <typename T, typename E>
 T ____mm_add_single(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         if (i == 0)
         {
@@ -56,7 +56,7 @@ template <typename T, typename E>
 T ____mm_sub_single(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         if (i == 0)
         {
@@ -76,7 +76,7 @@ T ____mm_sad_(T v1, T v2)
     T result;
     std::memset(&result, 0, sizeof(result));
     E_TMP tmp = 0;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         E x = v1.template at<E>(i);
         E y = v2.template at<E>(i);
@@ -106,7 +106,7 @@ template <typename T, typename E>
 T ____mm_mul_single(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         if (i == 0)
         {
@@ -135,7 +135,7 @@ template <typename T, typename E>
 T ____mm_div_single(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         if (i == 0)
         {
@@ -225,7 +225,7 @@ template <typename T, typename E, typename E_TMP>
 T ____mm_madd(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i += 2)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i += 2)
     {
         E_TMP tmp = v1.template at<E>(i) * (E_TMP)v2.template at<E>(i);
         tmp += v1.template at<E>(i) * (E_TMP)v2.template at<E>(i);
@@ -265,9 +265,9 @@ template <typename T, typename E, size_t N, typename... Args, typename = typenam
 T ____mm_setr(Args &&... args)
 {
     T result = ____mm_set<T, E, N>(args...);
-    for (size_t i = 0; i < (sizeof(T) / sizeof(E) / 2); i++)
+    for (size_t i = 0; i < (T::byteSize / sizeof(E) / 2); i++)
     {
-        std::swap(result.template at<E>(i), result.template at<E>((sizeof(T) / sizeof(E) - 1 - i)));
+        std::swap(result.template at<E>(i), result.template at<E>((T::byteSize / sizeof(E) - 1 - i)));
     }
     return result;
 }
@@ -277,7 +277,7 @@ T ____mm_set1(E x)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = x;
     }
@@ -288,7 +288,7 @@ template <typename T>
 T ____mm_setzero()
 {
     T result;
-    for (size_t i = 0; i < sizeof(T); i++)
+    for (size_t i = 0; i < T::byteSize; i++)
     {
         result.template at<uint8_t>(i) = 0;
     }
@@ -300,7 +300,7 @@ T ____mm_unpackhi(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0, j = (sizeof(T) / sizeof(E)) / 2; i < (sizeof(T) / sizeof(E)) / 2; i += 2, j++)
+    for (size_t i = 0, j = (T::byteSize / sizeof(E)) / 2; i < (T::byteSize / sizeof(E)) / 2; i += 2, j++)
     {
         target[i] = v1.template at<E>(j);
         target[i + 1] = v2.template at<E>(j);
@@ -313,7 +313,7 @@ T ____mm_unpacklo(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0, j = 0; i < (sizeof(T) / sizeof(E)) / 2; i += 2, j++)
+    for (size_t i = 0, j = 0; i < (T::byteSize / sizeof(E)) / 2; i += 2, j++)
     {
         target[i] = v1.template at<E>(j);
         target[i + 1] = v2.template at<E>(j);
@@ -326,7 +326,7 @@ T ____mm_cmpeq(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = v1.template at<E>(i) == v1.template at<E>(i) ? std::numeric_limits<E>::max() : 0;
     }
@@ -338,7 +338,7 @@ T ____mm_cmpgt(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = v1.template at<E>(i) > v1.template at<E>(i) ? std::numeric_limits<E>::max() : 0;
     }
@@ -350,7 +350,7 @@ T ____mm_cmpge(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = v1.template at<E>(i) >= v1.template at<E>(i) ? std::numeric_limits<E>::max() : 0;
     }
@@ -362,7 +362,7 @@ T ____mm_cmplt(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = v1.template at<E>(i) < v1.template at<E>(i) ? std::numeric_limits<E>::max() : 0;
     }
@@ -374,7 +374,7 @@ T ____mm_cmple(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = v1.template at<E>(i) <= v1.template at<E>(i) ? std::numeric_limits<E>::max() : 0;
     }
@@ -386,7 +386,7 @@ T ____mm_cmpneq(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = v1.template at<E>(i) != v1.template at<E>(i) ? std::numeric_limits<E>::max() : 0;
     }
@@ -398,7 +398,7 @@ T ____mm_cmpngt(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = !(v1.template at<E>(i) > v1.template at<E>(i)) ? std::numeric_limits<E>::max() : 0;
     }
@@ -410,7 +410,7 @@ T ____mm_cmpnge(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = !(v1.template at<E>(i) >= v1.template at<E>(i)) ? std::numeric_limits<E>::max() : 0;
     }
@@ -422,7 +422,7 @@ T ____mm_cmpnlt(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = !(v1.template at<E>(i) < v1.template at<E>(i)) ? std::numeric_limits<E>::max() : 0;
     }
@@ -434,7 +434,7 @@ T ____mm_cmpnle(T v1, T v2)
 {
     T result;
     E *target = reinterpret_cast<E *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         target[i] = !(v1.template at<E>(i) <= v1.template at<E>(i)) ? std::numeric_limits<E>::max() : 0;
     }
@@ -525,7 +525,7 @@ template <typename T, typename E>
 T ____mm_cmpord(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         bool x = v1.template at<E>(i) == std::numeric_limits<float>::quiet_NaN();
         bool y = v1.template at<E>(i) == std::numeric_limits<float>::quiet_NaN();
@@ -538,7 +538,7 @@ template <typename T, typename E>
 T ____mm_cmpunord(T v1, T v2)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         bool x = v1.template at<E>(i) != std::numeric_limits<float>::quiet_NaN();
         bool y = v1.template at<E>(i) != std::numeric_limits<float>::quiet_NaN();
@@ -605,7 +605,7 @@ T ____mm_and(T v1, T v2)
 {
     T result;
     uint8_t *target = reinterpret_cast<uint8_t *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(uint8_t); i++)
+    for (size_t i = 0; i < T::byteSize; i++)
     {
         target[i] = v1.template at<uint8_t>(i) & v2.template at<uint8_t>(i);
     }
@@ -617,7 +617,7 @@ T ____mm_or(T v1, T v2)
 {
     T result;
     uint8_t *target = reinterpret_cast<uint8_t *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(uint8_t); i++)
+    for (size_t i = 0; i < T::byteSize; i++)
     {
         target[i] = v1.template at<uint8_t>(i) | v2.template at<uint8_t>(i);
     }
@@ -629,7 +629,7 @@ T ____mm_xor(T v1, T v2)
 {
     T result;
     uint8_t *target = reinterpret_cast<uint8_t *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(uint8_t); i++)
+    for (size_t i = 0; i < T::byteSize; i++)
     {
         target[i] = v1.template at<uint8_t>(i) ^ v2.template at<uint8_t>(i);
     }
@@ -641,7 +641,7 @@ T ____mm_andnot(T v1, T v2)
 {
     T result;
     uint8_t *target = reinterpret_cast<uint8_t *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(uint8_t); i++)
+    for (size_t i = 0; i < T::byteSize; i++)
     {
         target[i] = (~v1.template at<uint8_t>(i)) & v2.template at<uint8_t>(i);
     }
@@ -679,7 +679,7 @@ T ____mm_packs(T v1, T v2)
 {
     T result;
     To *target = reinterpret_cast<To *>(&result);
-    for (size_t i = 0; i < sizeof(T) / sizeof(From); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(From); i++)
     {
         From temp = reinterpret_cast<From *>(&v1)[i];
         if (temp > std::numeric_limits<To>::max())
@@ -696,7 +696,7 @@ T ____mm_packs(T v1, T v2)
         }
         target++;
     }
-    for (size_t i = 0; i < sizeof(T) / sizeof(From); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(From); i++)
     {
         From temp = reinterpret_cast<From *>(&v2)[i];
         if (temp > std::numeric_limits<To>::max())
@@ -759,7 +759,7 @@ T ____mm_sll(T v, T count)
 {
     T result;
     std::memset(&result, 0, sizeof(T));
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         if (count.template at<int64_t>(0) < sizeof(E) - 1)
         {
@@ -774,7 +774,7 @@ T ____mm_slli(T v, int32_t imm)
 {
     T result;
     std::memset(&result, 0, sizeof(T));
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         if (reinterpret_cast<uint8_t *>(&imm)[0] < sizeof(E) - 1)
         {
@@ -789,7 +789,7 @@ T ____mm_srl(T v, T count)
 {
     T result;
     std::memset(&result, 0, sizeof(T));
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = ____shift_right_zero_extend(v.template at<E>(i), count.template at<int64_t>(0));
     }
@@ -801,7 +801,7 @@ T ____mm_srli(T v, int32_t imm)
 {
     T result;
     std::memset(&result, 0, sizeof(T));
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = ____shift_right_zero_extend(v.template at<E>(i), reinterpret_cast<uint8_t *>(&imm)[0]);
     }
@@ -813,7 +813,7 @@ T ____mm_sra(T v, T count)
 {
     T result;
     std::memset(&result, 0, sizeof(T));
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = ____shift_right_sign_extend(v.template at<E>(i), count.template at<int64_t>(0));
     }
@@ -824,7 +824,7 @@ template <typename T, typename E>
 T ____mm_srai(T v, int32_t imm)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = ____shift_right_sign_extend(v.template at<E>(i), reinterpret_cast<uint8_t *>(&imm)[0]);
     }
@@ -840,7 +840,7 @@ template <typename T, typename E>
 T ____mm_rcp(T v)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = static_cast<E>(1.0) / v.template at<E>(i);
     }
@@ -858,7 +858,7 @@ template <typename T, typename E>
 T ____mm_rsqrt(T v)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = static_cast<E>(1.0) / std::sqrt(v.template at<E>(i));
     }
@@ -877,7 +877,7 @@ template <typename T, typename E>
 T ____mm_sqrt(T v)
 {
     T result;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = std::sqrt(v.template at<E>(i));
     }
@@ -896,7 +896,7 @@ template <typename T, typename E>
 T ____mm_load(E *source)
 {
     T result;
-    std::memcpy(&result, source, sizeof(T));
+    std::memcpy(&result, source, T::byteSize);
     return result;
 }
 
@@ -915,7 +915,7 @@ T ____mm_load_single_all(E const *source)
 {
     T result;
     E e = *source;
-    for (size_t i = 0; i < sizeof(T) / sizeof(E); i++)
+    for (size_t i = 0; i < T::byteSize / sizeof(E); i++)
     {
         result.template at<E>(i) = e;
     }
@@ -0,0 +1,41 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include <iris/iris.h>
+using namespace iris;
+namespace lazy = iris::arm::lazy;
+
+// A filter step, (x * gain + bias) >> 4 masked to the low bits and
+// accumulated, written with the regular intrinsics, which store every
+// intermediate vector, and with the lazy ones, which evaluate it in one pass.
+constexpr size_t count = 1024;
+
+template<typename F>
+void bench(const char *name, F step, size_t rounds) {
+    static int16x8_t data[count];
+    for(size_t i = 0; i < count; i++) {
+        data[i] = vdupq_n_s16(static_cast<int16_t>(i * 37 - 5000));
+    }
+    int16x8_t gain = vdupq_n_s16(3), bias = vdupq_n_s16(-7), mask = vdupq_n_s16(0x3FFF);
+    int16x8_t acc = vdupq_n_s16(0);
+    auto start = std::chrono::steady_clock::now();
+    for(size_t r = 0; r < rounds; r++) {
+        for(size_t i = 0; i < count; i++) {
+            acc = step(acc, data[i], gain, bias, mask);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / (rounds * count);
+    std::printf("%-6s %8.2f ns per step (lane 0: %d)\n", name, ns, vgetq_lane_s16(acc, 0));
+}
+
+int main(int argc, char **argv) {
+    size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+    bench("eager", [](int16x8_t acc, int16x8_t x, int16x8_t gain, int16x8_t bias, int16x8_t mask) {
+        return vaddq_s16(acc, vandq_s16(vshrq_n_s16(vmlaq_s16(bias, x, gain), 4), mask));
+    }, rounds);
+    bench("lazy", [](int16x8_t acc, int16x8_t x, int16x8_t gain, int16x8_t bias, int16x8_t mask) -> int16x8_t {
+        return lazy::vaddq(acc, lazy::vandq(lazy::vshrq_n<4>(lazy::vmlaq(bias, x, gain)), mask));
+    }, rounds);
+}
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include <iris/iris.h>
+using namespace iris;
+
+// Load, lane insert and store round trips of the multi_vector intrinsics.
+// Each call hands a 32 to 64 byte aggregate to the family template and its
+// kernel, so redundant copies of it show up directly in the time per trip.
+template<typename T>
+void bench(const char *name,
+           T(*load)(const typename T::vectorType::elementType*),
+           T(*lane)(typename T::vectorType::elementType*, T, int32_t),
+           void(*store)(typename T::vectorType::elementType*, T),
+           size_t rounds) {
+    using E = typename T::vectorType::elementType;
+    constexpr size_t count = T::lanes * T::vectorType::length;
+    constexpr size_t blocks = 64;
+    static E buffer[blocks * count];
+    for(size_t i = 0; i < blocks * count; i++) {
+        buffer[i] = static_cast<E>(i * 7 + 3);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for(size_t r = 0; r < rounds; r++) {
+        for(size_t i = 0; i < blocks; i++) {
+            T v = load(buffer + i * count);
+            v = lane(buffer, v, static_cast<int32_t>(r % T::vectorType::length));
+            store(buffer + ((i + 1) % blocks) * count, v);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / (rounds * blocks);
+    unsigned checksum = 0;
+    for(size_t i = 0; i < blocks * count; i++) {
+        checksum = checksum * 31 + static_cast<unsigned>(buffer[i]);
+    }
+    std::printf("%-14s %2zu bytes %8.2f ns per trip (checksum %08x)\n", name, sizeof(T), ns, checksum);
+}
+
+int main(int argc, char **argv) {
+    size_t rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    bench<uint8x16x2_t>("vld2q_u8", vld2q_u8, vld2q_lane_u8, vst2q_u8, rounds);
+    bench<uint8x16x3_t>("vld3q_u8", vld3q_u8, vld3q_lane_u8, vst3q_u8, rounds);
+    bench<uint8x16x4_t>("vld4q_u8", vld4q_u8, vld4q_lane_u8, vst4q_u8, rounds);
+    bench<int16x8x4_t>("vld4q_s16", vld4q_s16, vld4q_lane_s16, vst4q_s16, rounds);
+    bench<float32x4x4_t>("vld4q_f32", vld4q_f32, vld4q_lane_f32, vst4q_f32, rounds);
+    bench<int16x4x4_t>("vld4_s16", vld4_s16, vld4_lane_s16, vst4_s16, rounds);
+}
@@ -0,0 +1,109 @@
+#include <cassert>
+
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+using namespace iris::arm;
+
+template<typename T, typename R>
+void cross_check(R(*a)(T), R(*b)(T)) {
+    for(uint32_t seed = 1; seed < 64; seed++) {
+        T v = random_lanes<T>(seed);
+        assert_same(a(v), b(v));
+    }
+}
+
+template<typename T, typename U, typename R>
+void cross_check(R(*a)(T,U), R(*b)(T,U)) {
+    for(uint32_t seed = 1; seed < 64; seed++) {
+        T v1 = random_lanes<T>(seed);
+        U v2 = random_lanes<U>(seed * 7);
+        assert_same(a(v1,v2), b(v1,v2));
+    }
+}
+
+template<typename T>
+void cross_check(T(*a)(T,T,T), T(*b)(T,T,T)) {
+    for(uint32_t seed = 1; seed < 64; seed++) {
+        T v1 = random_lanes<T>(seed), v2 = random_lanes<T>(seed * 7), v3 = random_lanes<T>(seed * 13);
+        assert_same(a(v1,v2,v3), b(v1,v2,v3));
+    }
+}
+
+template<typename T, typename B1, typename B2>
+void cross_check_vld3_vst3() {
+    using V = typename T::vectorType;
+    using E = typename V::elementType;
+    E src[3 * V::length], dst1[3 * V::length], dst2[3 * V::length];
+    for(size_t i = 0; i < 3 * V::length; i++) {
+        src[i] = static_cast<E>(i * 37 + 5);
+    }
+    T a = load::__vld<T, B1>(src);
+    T b = load::__vld<T, B2>(src);
+    for(size_t k = 0; k < 3; k++) {
+        assert_same(a.val[k], b.val[k]);
+    }
+    store::__vst<T, B1>(dst1, a);
+    store::__vst<T, B2>(dst2, a);
+    for(size_t i = 0; i < 3 * V::length; i++) {
+        check(dst1[i] == src[i] && dst2[i] == src[i]);
+    }
+}
+
+template<typename B1, typename B2>
+void cross_check_backends() {
+    cross_check(addition::__vadd<int16x8_t, B1>, addition::__vadd<int16x8_t, B2>);
+    cross_check(addition::__vqadd<uint8x16_t, B1>, addition::__vqadd<uint8x16_t, B2>);
+    cross_check(addition::__vaddl<int8x8_t, int16x8_t, B1>, addition::__vaddl<int8x8_t, int16x8_t, B2>);
+    cross_check(addition::__vaddw<uint32x4_t, uint16x4_t, B1>, addition::__vaddw<uint32x4_t, uint16x4_t, B2>);
+    cross_check(substraction::__vsubl<int32x2_t, int64x2_t, B1>, substraction::__vsubl<int32x2_t, int64x2_t, B2>);
+    cross_check(substraction::__vqsub<int16x4_t, B1>, substraction::__vqsub<int16x4_t, B2>);
+    cross_check(multiplication::__vmull<int32x2_t, int64x2_t, B1>, multiplication::__vmull<int32x2_t, int64x2_t, B2>);
+    cross_check(multiplication::__vmull<uint8x8_t, uint16x8_t, B1>, multiplication::__vmull<uint8x8_t, uint16x8_t, B2>);
+    cross_check(comparison::__vcgt<uint32x4_t, uint32x4_t, B1>, comparison::__vcgt<uint32x4_t, uint32x4_t, B2>);
+    cross_check(comparison::__vcage<float32x4_t, uint32x4_t, B1>, comparison::__vcage<float32x4_t, uint32x4_t, B2>);
+    cross_check(utility::__vrev64<uint8x16_t, B1>, utility::__vrev64<uint8x16_t, B2>);
+    cross_check(utility::__vrev32<int16x4_t, B1>, utility::__vrev32<int16x4_t, B2>);
+    cross_check(values::__vqabs<int8x16_t, B1>, values::__vqabs<int8x16_t, B2>);
+    cross_check(fma::__vfma<float32x4_t, B1>, fma::__vfma<float32x4_t, B2>);
+    cross_check(fma::__vfms<float32x2_t, B1>, fma::__vfms<float32x2_t, B2>);
+    cross_check(substraction::__vsubw<int64x2_t, int32x2_t, B1>, substraction::__vsubw<int64x2_t, int32x2_t, B2>);
+    cross_check(multiplication::__vmul<uint8x16_t, B1>, multiplication::__vmul<uint8x16_t, B2>);
+    cross_check(multiplication::__vmul<int32x2_t, B1>, multiplication::__vmul<int32x2_t, B2>);
+    cross_check(multiplication::__vmul<float32x4_t, B1>, multiplication::__vmul<float32x4_t, B2>);
+    cross_check(multiplication::__vmull<int16x4_t, int32x4_t, B1>, multiplication::__vmull<int16x4_t, int32x4_t, B2>);
+    cross_check(multiplication_addition::__vmla<int16x8_t, B1>, multiplication_addition::__vmla<int16x8_t, B2>);
+    cross_check(multiplication_substraction::__vmls<uint32x4_t, B1>, multiplication_substraction::__vmls<uint32x4_t, B2>);
+    cross_check(bitwise::__vbic<int64x2_t, B1>, bitwise::__vbic<int64x2_t, B2>);
+    cross_check(bitwise::__veor<uint16x4_t, B1>, bitwise::__veor<uint16x4_t, B2>);
+    cross_check(bitwise::__vorn<int8x8_t, B1>, bitwise::__vorn<int8x8_t, B2>);
+    cross_check(comparison::__vceq<float32x2_t, uint32x2_t, B1>, comparison::__vceq<float32x2_t, uint32x2_t, B2>);
+    cross_check(comparison::__vtst<int16x8_t, uint16x8_t, B1>, comparison::__vtst<int16x8_t, uint16x8_t, B2>);
+    cross_check(comparison::__vcle<int8x16_t, uint8x16_t, B1>, comparison::__vcle<int8x16_t, uint8x16_t, B2>);
+    cross_check(values::__vneg<int8x16_t, B1>, values::__vneg<int8x16_t, B2>);
+    cross_check(values::__vmax<float32x4_t, B1>, values::__vmax<float32x4_t, B2>);
+    cross_check(values::__vmin<uint32x2_t, B1>, values::__vmin<uint32x2_t, B2>);
+    for(uint32_t n = 0; n < 8; n++) {
+        int8x16_t v = random_lanes<int8x16_t>(n + 3);
+        assert_same(shift::__vshl_n<int8x16_t, B1>(v, n), shift::__vshl_n<int8x16_t, B2>(v, n));
+        assert_same(shift::__vshr_n<int8x16_t, B1>(v, n), shift::__vshr_n<int8x16_t, B2>(v, n));
+        uint16x4_t u = random_lanes<uint16x4_t>(n + 5);
+        assert_same(shift::__vshr_n<uint16x4_t, B1>(u, 2 * n), shift::__vshr_n<uint16x4_t, B2>(u, 2 * n));
+    }
+    for(int32_t n = 0; n < 16; n++) {
+        uint8x16_t v1 = random_lanes<uint8x16_t>(n + 1), v2 = random_lanes<uint8x16_t>(n + 2);
+        assert_same(utility::__vext<uint8x16_t, B1>(v1, v2, n), utility::__vext<uint8x16_t, B2>(v1, v2, n));
+    }
+    cross_check_vld3_vst3<uint8x16x3_t, B1, B2>();
+    cross_check_vld3_vst3<int16x4x3_t, B1, B2>();
+}
+
+int main() {
+    cross_check_backends<backend::scalar, backend::sse2>();
+    cross_check_backends<backend::scalar, backend::avx2>();
+    cross_check_backends<backend::scalar, backend::generic>();
+    cross_check_backends<backend::sse2, backend::best>();
+}
@@ -0,0 +1,74 @@
+#include <cassert>
+
+#include <limits>
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+
+template<typename T>
+constexpr T iota(typename T::elementType start) {
+    T v;
+    for(size_t i = 0; i < T::length; i++) {
+        v.at(i) = static_cast<typename T::elementType>(start + static_cast<typename T::elementType>(i));
+    }
+    return v;
+}
+
+// tables folded at compile time from the intrinsics
+constexpr uint8x16_t ones = vdupq_n_u8(1);
+constexpr uint32x4_t masks = vshlq_n_u32(vdupq_n_u32(1), 7);
+constexpr int16x8_t sums = vaddq_s16(iota<int16x8_t>(0), iota<int16x8_t>(100));
+constexpr uint16x8_t widened = vaddl_u8(vdup_n_u8(200), vdup_n_u8(100));
+constexpr int32x4_t products = vmull_s16(vdup_n_s16(-300), iota<int16x4_t>(1));
+constexpr uint8x16_t reversed = vrev64q_u8(iota<uint8x16_t>(0));
+constexpr uint8x16_t shifted = vextq_u8(iota<uint8x16_t>(0), iota<uint8x16_t>(16), 3);
+constexpr uint8x16_t saturated = vqaddq_u8(vdupq_n_u8(250), iota<uint8x16_t>(0));
+constexpr int8x16_t clamped = vqsubq_s8(vdupq_n_s8(-120), iota<int8x16_t>(0));
+constexpr uint16x8_t greater = vcgtq_s16(iota<int16x8_t>(-4), vdupq_n_s16(0));
+constexpr int32x4_t maxima = vmaxq_s32(iota<int32x4_t>(-2), vnegq_s32(iota<int32x4_t>(-2)));
+constexpr uint16x8_t accumulated = vmlaq_u16(vdupq_n_u16(1), iota<uint16x8_t>(0), vdupq_n_u16(3));
+constexpr int16x8_t combined = vcombine_s16(vdup_n_s16(5), vdup_n_s16(-5));
+
+static_assert(vgetq_lane_u8(ones, 15) == 1, "vdupq_n_u8");
+static_assert(vgetq_lane_u32(masks, 2) == 128, "vshlq_n_u32");
+static_assert(vgetq_lane_s16(sums, 5) == 110, "vaddq_s16");
+static_assert(vgetq_lane_u16(widened, 0) == 300, "vaddl_u8");
+static_assert(vgetq_lane_s32(products, 3) == -1200, "vmull_s16");
+static_assert(vgetq_lane_u8(reversed, 0) == 7 && vgetq_lane_u8(reversed, 8) == 15, "vrev64q_u8");
+static_assert(vgetq_lane_u8(shifted, 0) == 3 && vgetq_lane_u8(shifted, 15) == 18, "vextq_u8");
+static_assert(vgetq_lane_u8(saturated, 4) == 254 && vgetq_lane_u8(saturated, 9) == 255, "vqaddq_u8");
+static_assert(vgetq_lane_s8(clamped, 3) == -123 && vgetq_lane_s8(clamped, 15) == -128, "vqsubq_s8");
+static_assert(vgetq_lane_u16(greater, 4) == 0 && vgetq_lane_u16(greater, 5) == 0xFFFF, "vcgtq_s16");
+static_assert(vgetq_lane_s32(maxima, 0) == 2 && vgetq_lane_s32(maxima, 3) == 1, "vmaxq_s32");
+static_assert(vgetq_lane_u16(accumulated, 7) == 22, "vmlaq_u16");
+static_assert(vgetq_lane_s16(combined, 3) == 5 && vgetq_lane_s16(combined, 4) == -5, "vcombine_s16");
+
+// lanes wrap as on NEON instead of overflowing, in constant evaluation too
+constexpr int32_t int32_min = std::numeric_limits<int32_t>::min();
+constexpr int32_t int32_max = std::numeric_limits<int32_t>::max();
+static_assert(vgetq_lane_s32(vshlq_n_s32(vdupq_n_s32(-1), 1), 0) == -2, "vshlq_n_s32 of a negative lane");
+static_assert(vgetq_lane_s32(vshlq_n_s32(vdupq_n_s32(int32_max), 31), 1) == int32_min, "vshlq_n_s32 into the sign bit");
+static_assert(vgetq_lane_s16(vshlq_s16(vdupq_n_s16(-1), vdupq_n_s16(15)), 2) == -32768, "vshlq_s16 of a negative lane");
+static_assert(vgetq_lane_s32(vnegq_s32(vdupq_n_s32(int32_min)), 3) == int32_min, "vnegq_s32 of the minimum");
+static_assert(vgetq_lane_u16(vmulq_u16(vdupq_n_u16(0xffff), vdupq_n_u16(0xffff)), 0) == 1, "vmulq_u16 of promoted lanes");
+static_assert(vgetq_lane_s32(vmulq_s32(vdupq_n_s32(int32_min), vdupq_n_s32(-1)), 0) == int32_min, "vmulq_s32 of the minimum");
+static_assert(vgetq_lane_s32(vaddq_s32(vdupq_n_s32(int32_max), vdupq_n_s32(1)), 1) == int32_min, "vaddq_s32 past the maximum");
+static_assert(vgetq_lane_s32(vsubq_s32(vdupq_n_s32(int32_min), vdupq_n_s32(1)), 2) == int32_max, "vsubq_s32 past the minimum");
+static_assert(vgetq_lane_s32(vmlaq_s32(vdupq_n_s32(int32_max), vdupq_n_s32(2), vdupq_n_s32(2)), 0) == int32_min + 3, "vmlaq_s32 past the maximum");
+
+int main() {
+    // the same intrinsics at run time agree with the folded tables
+    int16x8_t a = iota<int16x8_t>(0);
+    int16x8_t b = iota<int16x8_t>(100);
+    int16x8_t runtime_sums = vaddq_s16(a, b);
+    uint8x16_t runtime_saturated = vqaddq_u8(vdupq_n_u8(250), iota<uint8x16_t>(0));
+    for(size_t i = 0; i < 8; i++) {
+        check(runtime_sums.at(i) == sums.at(i));
+    }
+    for(size_t i = 0; i < 16; i++) {
+        check(runtime_saturated.at(i) == saturated.at(i));
+    }
+}
@@ -0,0 +1,46 @@
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef IRIS_TEST_HELPERS
+#define IRIS_TEST_HELPERS
+
+// Shared by the tests that compare kernels against each other or against a
+// reference on pseudo-random lanes.
+
+// assert() that still checks under NDEBUG, so Release builds of these tests
+// compare lanes too and every operand stays used
+inline void check(bool ok) {
+    assert(ok);
+    if(!ok) {
+        std::abort();
+    }
+}
+
+// one step of the linear congruential generator every randomized test uses
+inline uint32_t next_seed(uint32_t &seed) {
+    seed = seed * 1103515245u + 12345u;
+    return seed;
+}
+
+// lanes from successive generator states, dropping the short-period low byte
+template<typename T>
+T random_lanes(uint32_t seed) {
+    T v;
+    for(size_t i = 0; i < T::length; i++) {
+        v.template at<typename T::elementType>(i) = static_cast<typename T::elementType>(static_cast<int32_t>(next_seed(seed)) >> 8);
+    }
+    return v;
+}
+
+// lane by lane bit patterns, so NaN payloads and signed zeros must match too
+template<typename T>
+void assert_same(const T &a, const T &b) {
+    using E = typename T::elementType;
+    for(size_t i = 0; i < T::length; i++) {
+        check(std::memcmp(&a.template at<E>(i), &b.template at<E>(i), sizeof(E)) == 0);
+    }
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include <cassert>
+
+#include <numeric>
+#include <utility>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+using namespace iris::arm;
+
+template<typename E>
+void assert_equal(E a, E b) {
+    check(a == b);
+}
+
+// every lane n against the runtime-lane templates
+template<typename T, size_t... n>
+void test_lanes(std::index_sequence<n...>) {
+    using E = typename T::elementType;
+    T v1 = random_lanes<T>(3), v2 = random_lanes<T>(5), v3 = random_lanes<T>(7);
+    E x = static_cast<E>(42);
+    (assert_equal(__vget_lane<n>(v1), __vget_lane<T, E>(v1, n)), ...);
+    (assert_same(__vset_lane<n>(x, v1), __vset_lane<T>(x, v1, n)), ...);
+    (assert_same(__vdup_lane<n>(v1), __vdup_lane<T, E>(v1, n)), ...);
+    (assert_same(__vdup_lane<n, T, backend::scalar>(v1), __vdup_lane<T, E>(v1, n)), ...);
+    (assert_same(__vext<n>(v1, v2), __vext<T, backend::scalar>(v1, v2, n)), ...);
+    if constexpr (sizeof(E) < 8) {
+        (assert_same(__vmul_lane<n>(v1, v2), __vmul_lane<T>(v1, v2, n)), ...);
+        (assert_same(__vmla_lane<n>(v1, v2, v3), __vmla_lane<T>(v1, v2, v3, n)), ...);
+    }
+}
+
+// VRSHR, (x + 2^(n-1)) >> n, in a wider type; 64-bit lanes take the floor
+// of x / 2^n and round up when the remainder is at least 2^(n-1)
+template<typename E>
+E rounding_shift(E x, uint32_t n) {
+    if constexpr (sizeof(E) < 8) {
+        using W = typename std::conditional<std::is_signed<E>::value, int64_t, uint64_t>::type;
+        return static_cast<E>((static_cast<W>(x) + (W(1) << (n - 1))) >> n);
+    } else {
+        uint64_t bits = static_cast<uint64_t>(x);
+        uint64_t remainder = n == 64 ? bits : bits & ((uint64_t(1) << n) - 1);
+        E floor = n < 64 ? static_cast<E>(x >> n) : static_cast<E>(std::is_signed<E>::value && (bits >> 63) ? -1 : 0);
+        return static_cast<E>(floor + (remainder >= (uint64_t(1) << (n - 1)) ? 1 : 0));
+    }
+}
+
+template<typename T>
+T rounding_shift_lanes(T v, uint32_t n) {
+    T result;
+    for(size_t i = 0; i < T::length; i++) {
+        result.template at<typename T::elementType>(i) = rounding_shift(v.template at<typename T::elementType>(i), n);
+    }
+    return result;
+}
+
+// every shift count n valid for vshl_n (0..bits-1) and vshr_n (1..bits)
+template<typename T, uint32_t... n>
+void test_shifts(std::integer_sequence<uint32_t, n...>) {
+    using E = typename T::elementType;
+    constexpr uint32_t bits = sizeof(E) * 8;
+    T v = random_lanes<T>(11);
+    (assert_same(__vshl_n<n>(v), __vshl_n<T, backend::scalar>(v, n)), ...);
+    (assert_same(__vshr_n<n + 1>(v), __vshr_n<T, backend::scalar>(v, n + 1)), ...);
+    (assert_same(__vshr_n<n + 1>(v), __vshr_n<T>(v, n + 1)), ...);
+    (assert_same(__vrshr_n<n + 1>(v), rounding_shift_lanes(v, n + 1)), ...);
+    (assert_same(__vrshr_n<T>(v, n + 1), rounding_shift_lanes(v, n + 1)), ...);
+    T full = __vshr_n<bits>(v);
+    T runtime = __vshr_n<T>(v, bits);
+    for(size_t i = 0; i < T::length; i++) {
+        E expected = v.template at<E>(i) < 0 ? static_cast<E>(-1) : 0;
+        check(full.template at<E>(i) == expected);
+        check(runtime.template at<E>(i) == expected);
+    }
+}
+
+template<typename T>
+void test_type() {
+    test_lanes<T>(std::make_index_sequence<T::length>());
+    if constexpr (std::is_integral<typename T::elementType>::value) {
+        test_shifts<T>(std::make_integer_sequence<uint32_t, sizeof(typename T::elementType) * 8>());
+    }
+}
+
+// intrinsic style names and constant evaluation
+static_assert(vgetq_lane<3>(vshlq_n<7>(vdupq_n_u32(1))) == 128, "vshlq_n");
+static_assert(vget_lane<0>(vshr_n<8>(vdup_n_s8(-100))) == -1, "vshr_n");
+static_assert(vgetq_lane<0>(vshrq_n<16>(vdupq_n_u16(40000))) == 0, "vshrq_n");
+static_assert(vgetq_lane<15>(vsetq_lane<15>(uint8_t(7), vdupq_n_u8(0))) == 7, "vsetq_lane");
+static_assert(vget_lane<1>(vdup_lane<0>(vset_lane<0>(5.0f, vdup_n_f32(0.0f)))) == 5.0f, "vdup_lane");
+static_assert(vgetq_lane<0>(vextq<1>(vdupq_n_s32(1), vdupq_n_s32(2))) == 1, "vextq");
+
+int main() {
+    test_type<int8x8_t>();
+    test_type<int16x4_t>();
+    test_type<int32x2_t>();
+    test_type<int64x1_t>();
+    test_type<uint8x8_t>();
+    test_type<uint16x4_t>();
+    test_type<uint32x2_t>();
+    test_type<uint64x1_t>();
+    test_type<float32x2_t>();
+    test_type<int8x16_t>();
+    test_type<int16x8_t>();
+    test_type<int32x4_t>();
+    test_type<int64x2_t>();
+    test_type<uint8x16_t>();
+    test_type<uint16x8_t>();
+    test_type<uint32x4_t>();
+    test_type<uint64x2_t>();
+    test_type<float32x4_t>();
+    check(vgetq_lane<2>(vrshrq_n<2>(vdupq_n_s16(-9))) == -2);
+    check(vgetq_lane<0>(vrshrq_n<3>(vdupq_n_s16(32767))) == 4096);
+    check(vgetq_lane<5>(vrshrq_n<3>(vdupq_n_s16(-21973))) == -2747);
+    check(vget_lane<0>(vrshr_n<64>(vdup_n_u64(0x8000000000000000u))) == 1);
+    check(vgetq_lane<3>(vmlaq_lane<1>(vdupq_n_f32(1.0f), vdupq_n_f32(2.0f), vset_lane<1>(3.0f, vdup_n_f32(0.0f)))) == 7.0f);
+    check(vgetq_lane<3>(vmlaq_laneq<3>(vdupq_n_f32(1.0f), vdupq_n_f32(2.0f), vsetq_lane<3>(3.0f, vdupq_n_f32(0.0f)))) == 7.0f);
+    check(vgetq_lane<7>(vmulq_lane<2>(vdupq_n_s16(3), vset_lane<2>(int16_t(-5), vdup_n_s16(0)))) == -15);
+    check(vgetq_lane<0>(vmulq_laneq<6>(vdupq_n_u16(3), vsetq_lane<6>(uint16_t(5), vdupq_n_u16(0)))) == 15);
+    check(vgetq_lane<3>(vdupq_lane<1>(vset_lane<1>(int32_t(9), vdup_n_s32(0)))) == 9);
+    check(vgetq_lane<0>(vdupq_laneq<2>(vsetq_lane<2>(int32_t(9), vdupq_n_s32(0)))) == 9);
+    check(vget_lane<1>(vmul_lane<0>(vdup_n_s16(4), vdup_n_s16(-2))) == -8);
+}
@@ -0,0 +1,65 @@
+#include <cassert>
+
+#include <cmath>
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+namespace lazy = iris::arm::lazy;
+
+// fused trees against the same chain of eager family templates
+template<typename T>
+void test_integer() {
+    for(uint32_t seed = 1; seed < 32; seed++) {
+        T a = random_lanes<T>(seed), b = random_lanes<T>(seed * 7), c = random_lanes<T>(seed * 13);
+        if constexpr (T::byteSize == 16) {
+            assert_same<T>(lazy::vaddq(lazy::vmulq(a, b), c), __vadd(__vmul(a, b), c));
+            assert_same<T>(lazy::vmlsq(a, b, c), __vmls(a, b, c));
+            assert_same<T>(lazy::vshrq_n<3>(lazy::vmlaq(a, b, c)), __vshr_n<3>(__vmla(a, b, c)));
+            assert_same<T>(lazy::veorq(lazy::vandq(a, b), lazy::vorrq(lazy::vshlq_n<1>(c), a)), __veor(__vand(a, b), __vorr(__vshl_n<1>(c), a)));
+            assert_same<T>(lazy::vshrq_n<sizeof(typename T::elementType) * 8>(lazy::vsubq(a, b)), __vshr_n<sizeof(typename T::elementType) * 8>(__vsub(a, b)));
+        } else {
+            assert_same<T>(lazy::vadd(lazy::vmul(a, b), c), __vadd(__vmul(a, b), c));
+            assert_same<T>(lazy::vmls(a, b, c), __vmls(a, b, c));
+            assert_same<T>(lazy::vshr_n<3>(lazy::vmla(a, b, c)), __vshr_n<3>(__vmla(a, b, c)));
+            assert_same<T>(lazy::veor(lazy::vand(a, b), lazy::vorr(lazy::vshl_n<1>(c), a)), __veor(__vand(a, b), __vorr(__vshl_n<1>(c), a)));
+            assert_same<T>(lazy::vshr_n<sizeof(typename T::elementType) * 8>(lazy::vsub(a, b)), __vshr_n<sizeof(typename T::elementType) * 8>(__vsub(a, b)));
+        }
+    }
+}
+
+// narrow products wrap as on NEON
+constexpr uint16x8_t wrapped = lazy::vmlaq(vdupq_n_u16(1), vdupq_n_u16(65535), vdupq_n_u16(65535));
+constexpr int8x8_t shifted = lazy::vshr_n<2>(lazy::vadd(vdup_n_s8(-100), vdup_n_s8(-100)));
+static_assert(vgetq_lane_u16(wrapped, 7) == 2, "vmlaq wraps");
+static_assert(vget_lane_s8(shifted, 0) == static_cast<int8_t>(56 >> 2), "vshr_n after vadd");
+
+int main() {
+    test_integer<int8x8_t>();
+    test_integer<int16x4_t>();
+    test_integer<int32x2_t>();
+    test_integer<uint8x8_t>();
+    test_integer<uint16x4_t>();
+    test_integer<uint32x2_t>();
+    test_integer<int8x16_t>();
+    test_integer<int16x8_t>();
+    test_integer<int32x4_t>();
+    test_integer<uint8x16_t>();
+    test_integer<uint16x8_t>();
+    test_integer<uint32x4_t>();
+
+    // float vmla rounds twice, as vmlaq_f32 does; vfmaq rounds once
+    float32x4_t a = vdupq_n_f32(1.0f + 1.0f / 4096), b = vdupq_n_f32(1.0f - 1.0f / 4096), c = vdupq_n_f32(-1.0f);
+    assert_same<float32x4_t>(lazy::vmlaq(c, a, b), vmlaq_f32(c, a, b));
+    assert_same<float32x4_t>(lazy::vfmaq(c, a, b), vfmaq_f32(c, a, b));
+    check(vgetq_lane_f32(lazy::eval(lazy::vfmaq(c, a, b)), 0) == std::fma(1.0f + 1.0f / 4096, 1.0f - 1.0f / 4096, -1.0f));
+    assert_same<float32x2_t>(lazy::vsub(lazy::vmul(vget_low_f32(a), vget_low_f32(b)), vget_low_f32(c)), vsub_f32(vmul_f32(vget_low_f32(a), vget_low_f32(b)), vget_low_f32(c)));
+
+    // nodes keep their operands, and convert where a vector is expected
+    auto node = lazy::vaddq(vdupq_n_s32(20), vdupq_n_s32(22));
+    check(vgetq_lane_s32(node, 3) == 42);
+    check(vgetq_lane_s32(vmulq_s32(node, node), 0) == 42 * 42);
+    check(vgetq_lane_s32(lazy::eval(lazy::vmulq(node, node)), 1) == 42 * 42);
+}
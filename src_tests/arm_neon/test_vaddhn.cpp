@@ -26,6 +26,21 @@ void test_vaddhn(R(*func)(T,T)) {
         printBinary(result.template at<typename R::elementType>(i));
         assert(result.template at<typename R::elementType>(i) == static_cast<typename T::elementType>(3));
     }
+    // no rounding, and the sum wraps before the high half is taken
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
+        v2.template at<typename T::elementType>(i) = static_cast<typename T::elementType>(i);
+    }
+    result = func(v1,v2);
+    for(size_t i = 0; i < T::length; i++) {
+        typename R::elementType expected;
+        if(std::is_signed<typename T::elementType>::value) {
+            expected = i == 0 ? std::numeric_limits<typename R::elementType>::max() : std::numeric_limits<typename R::elementType>::min();
+        } else {
+            expected = i == 0 ? std::numeric_limits<typename R::elementType>::max() : 0;
+        }
+        assert(result.template at<typename R::elementType>(i) == expected);
+    }
 }
 
 
@@ -33,4 +48,7 @@ int main() {
     test_vaddhn(vaddhn_s16);
     test_vaddhn(vaddhn_s32);
     test_vaddhn(vaddhn_s64);
+    test_vaddhn(vaddhn_u16);
+    test_vaddhn(vaddhn_u32);
+    test_vaddhn(vaddhn_u64);
 }
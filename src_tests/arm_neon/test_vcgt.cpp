@@ -33,6 +33,20 @@ void test_vcgt(R(*func)(T,T)) {
     for(size_t i = 0; i < T::length; i++) {
         assert(result.template at<typename R::elementType>(i) == std::numeric_limits<typename R::elementType>::max());
     }
+
+    // extremes of the range, including unsigned lanes with the top bit set
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
+        v2.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::lowest();
+    }
+    result = func(v1,v2);
+    for(size_t i = 0; i < T::length; i++) {
+        assert(result.template at<typename R::elementType>(i) == std::numeric_limits<typename R::elementType>::max());
+    }
+    result = func(v2,v1);
+    for(size_t i = 0; i < T::length; i++) {
+        assert(result.template at<typename R::elementType>(i) == std::numeric_limits<typename R::elementType>::min());
+    }
 }
 
 int main() {
@@ -0,0 +1,91 @@
+#include <cassert>
+
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+
+// bit by bit references
+template<typename E>
+int popcount(E x) {
+    int n = 0;
+    for(size_t i = 0; i < sizeof(E) * 8; i++) {
+        n += (static_cast<uint64_t>(x) >> i) & 1;
+    }
+    return n;
+}
+
+template<typename E>
+int clz(E x) {
+    int n = 0;
+    for(int i = sizeof(E) * 8 - 1; i >= 0 && !((static_cast<uint64_t>(x) >> i) & 1); i--) {
+        n++;
+    }
+    return n;
+}
+
+template<typename E>
+int cls(E x) {
+    const int bits = sizeof(E) * 8;
+    uint64_t u = static_cast<uint64_t>(x);
+    int n = 0;
+    for(int i = bits - 2; i >= 0 && ((u >> i) & 1) == ((u >> (bits - 1)) & 1); i--) {
+        n++;
+    }
+    return n;
+}
+
+// every 8 and 16-bit value, and single bits, bit runs and pseudo-random 32-bit ones
+template<typename T>
+void test_type(T(*func)(T), int(*reference)(typename T::elementType)) {
+    using E = typename T::elementType;
+    using U = typename std::make_unsigned<E>::type;
+    const uint64_t count = sizeof(E) < 4 ? uint64_t(1) << (sizeof(E) * 8) : 4096;
+    uint32_t seed = 1;
+    for(uint64_t base = 0; base < count; base += T::length) {
+        T v;
+        for(size_t i = 0; i < T::length; i++) {
+            uint64_t j = base + i;
+            next_seed(seed);
+            U bits = sizeof(E) < 4 ? static_cast<U>(j) : j < 32 ? static_cast<U>(U(1) << j) : j < 64 ? static_cast<U>(~U(0) >> (j - 32)) : static_cast<U>(seed >> (seed % 32));
+            v.template at<E>(i) = static_cast<E>(bits);
+        }
+        T r = func(v);
+        for(size_t i = 0; i < T::length; i++) {
+            check(r.template at<E>(i) == static_cast<E>(reference(v.template at<E>(i))));
+        }
+    }
+}
+
+static_assert(vgetq_lane_u8(vcntq_u8(vdupq_n_u8(0xb5)), 9) == 5, "vcntq_u8");
+static_assert(vgetq_lane_u32(vclzq_u32(vdupq_n_u32(0x00f00000)), 0) == 8, "vclzq_u32");
+static_assert(vgetq_lane_s16(vclsq_s16(vdupq_n_s16(-3)), 0) == 13, "vclsq_s16");
+
+int main() {
+    test_type(vcnt_u8, popcount<uint8_t>);
+    test_type(vcnt_s8, popcount<int8_t>);
+    test_type(vcntq_u8, popcount<uint8_t>);
+    test_type(vcntq_s8, popcount<int8_t>);
+
+    test_type(vclz_u8, clz<uint8_t>);
+    test_type(vclz_u16, clz<uint16_t>);
+    test_type(vclz_u32, clz<uint32_t>);
+    test_type(vclz_s8, clz<int8_t>);
+    test_type(vclz_s16, clz<int16_t>);
+    test_type(vclz_s32, clz<int32_t>);
+    test_type(vclzq_u8, clz<uint8_t>);
+    test_type(vclzq_u16, clz<uint16_t>);
+    test_type(vclzq_u32, clz<uint32_t>);
+    test_type(vclzq_s8, clz<int8_t>);
+    test_type(vclzq_s16, clz<int16_t>);
+    test_type(vclzq_s32, clz<int32_t>);
+
+    test_type(vcls_s8, cls<int8_t>);
+    test_type(vcls_s16, cls<int16_t>);
+    test_type(vcls_s32, cls<int32_t>);
+    test_type(vclsq_s8, cls<int8_t>);
+    test_type(vclsq_s16, cls<int16_t>);
+    test_type(vclsq_s32, cls<int32_t>);
+}
@@ -13,10 +13,10 @@ void test_vext(T(*func)(T,T,int32_t)) {
     for(size_t i = 0; i < T::length; i++) {
         T result = func(v1,v2,i);
         for(size_t j = 0; j < T::length; j++) {
-            if(j < i + 1) {
-                assert(result.template at<typename T::elementType>(j) == v2.template at<typename T::elementType>(j));
+            if(i + j < T::length) {
+                assert(result.template at<typename T::elementType>(j) == v1.template at<typename T::elementType>(i + j));
             } else {
-                assert(result.template at<typename T::elementType>(j) == v1.template at<typename T::elementType>(T::length - (j - i)));
+                assert(result.template at<typename T::elementType>(j) == v2.template at<typename T::elementType>(i + j - T::length));
             }
         }
     }
@@ -13,12 +13,28 @@ void test_vfma(T(*func)(T,T,T)){
     }
     T result = func(v1,v2,v3);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) = (i+1) * (T::length - i + 1) + (2*i));
+        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>((i+1) * (T::length - i + 1) + (2*i)));
     }
 
 }
 
+template<typename T>
+void test_vfma_single_rounding(T(*func)(T,T,T)){
+    T v1, v2, v3;
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<float>(i) = -(1.0f + 0x1p-11f);
+        v2.template at<float>(i) = 1.0f + 0x1p-12f;
+        v3.template at<float>(i) = 1.0f + 0x1p-12f;
+    }
+    T result = func(v1,v2,v3);
+    for(size_t i = 0; i < T::length; i++) {
+        assert(result.template at<float>(i) == 0x1p-24f);
+    }
+}
+
 int main() {
     test_vfma(vfma_f32);
     test_vfma(vfmaq_f32);
+    test_vfma_single_rounding(vfma_f32);
+    test_vfma_single_rounding(vfmaq_f32);
 }
@@ -1,5 +1,7 @@
 #include <iris/iris.h>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 using namespace iris;
 
@@ -13,12 +15,49 @@ void test_vfms(T(*func)(T,T,T)){
     }
     T result = func(v1,v2,v3);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) = (i+1) * (T::length - i + 1) - (2*i));
+        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>(static_cast<typename T::elementType>(2*i) - static_cast<typename T::elementType>(i+1) * static_cast<typename T::elementType>(T::length - i + 1)));
     }
 
 }
 
+template<typename T>
+void test_vfms_single_rounding(T(*func)(T,T,T)){
+    T v1, v2, v3;
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<float>(i) = 1.0f + 0x1p-11f;
+        v2.template at<float>(i) = 1.0f + 0x1p-12f;
+        v3.template at<float>(i) = 1.0f + 0x1p-12f;
+    }
+    T result = func(v1,v2,v3);
+    for(size_t i = 0; i < T::length; i++) {
+        assert(result.template at<float>(i) == -0x1p-24f);
+    }
+}
+
+// the operand is negated before the fused multiply-add, so a NaN in v2
+// comes out with its sign flipped on every backend
+template<typename T>
+void test_vfms_nan(T(*func)(T,T,T)){
+    T v1, v2, v3;
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<float>(i) = 1.0f;
+        v2.template at<float>(i) = 2.0f;
+        v3.template at<float>(i) = 3.0f;
+    }
+    v2.template at<float>(T::length - 1) = std::numeric_limits<float>::quiet_NaN();
+    T result = func(v1,v2,v3);
+    for(size_t i = 0; i + 1 < T::length; i++) {
+        assert(result.template at<float>(i) == -5.0f);
+    }
+    assert(std::isnan(result.template at<float>(T::length - 1)));
+    assert(std::signbit(result.template at<float>(T::length - 1)));
+}
+
 int main() {
     test_vfms(vfms_f32);
     test_vfms(vfmsq_f32);
+    test_vfms_single_rounding(vfms_f32);
+    test_vfms_single_rounding(vfmsq_f32);
+    test_vfms_nan(vfms_f32);
+    test_vfms_nan(vfmsq_f32);
 }
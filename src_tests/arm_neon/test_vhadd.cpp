@@ -1,5 +1,6 @@
 #include <iris/iris.h>
 #include <cassert>
+#include <limits>
 
 using namespace iris;
 
@@ -16,6 +17,22 @@ void test_vhadd(T(*func)(T,T)) {
     }
 }
 
+template<typename T>
+void test_vhadd_limits(T(*func)(T,T)) {
+    using E = typename T::elementType;
+    T v1, v2;
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<E>(i) = (i % 2) ? std::numeric_limits<E>::max() - i : std::numeric_limits<E>::min() + i;
+        v2.template at<E>(i) = (i % 3) ? std::numeric_limits<E>::max() - 2*i : std::numeric_limits<E>::min() + 3*i;
+    }
+    T result = func(v1,v2);
+    for(size_t i = 0; i < T::length; i++) {
+        int64_t x = v1.template at<E>(i);
+        int64_t y = v2.template at<E>(i);
+        assert(result.template at<E>(i) == static_cast<E>((x + y) >> 1));
+    }
+}
+
 int main() {
     test_vhadd(vhadd_s8);
     test_vhadd(vhadd_s16);
@@ -32,4 +49,17 @@ int main() {
     test_vhadd(vhaddq_u8);
     test_vhadd(vhaddq_u16);
     test_vhadd(vhaddq_u32);
+
+    test_vhadd_limits(vhadd_s8);
+    test_vhadd_limits(vhadd_s16);
+    test_vhadd_limits(vhadd_s32);
+    test_vhadd_limits(vhadd_u8);
+    test_vhadd_limits(vhadd_u16);
+    test_vhadd_limits(vhadd_u32);
+    test_vhadd_limits(vhaddq_s8);
+    test_vhadd_limits(vhaddq_s16);
+    test_vhadd_limits(vhaddq_s32);
+    test_vhadd_limits(vhaddq_u8);
+    test_vhadd_limits(vhaddq_u16);
+    test_vhadd_limits(vhaddq_u32);
 }
@@ -1,5 +1,6 @@
 #include <iris/iris.h>
 #include <cassert>
+#include <limits>
 
 using namespace iris;
 
@@ -12,7 +13,25 @@ void test_vhsub(T(*func)(T,T)) {
     }
     T result = func(v1,v2);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>(i));
+        int64_t x = v1.template at<typename T::elementType>(i);
+        int64_t y = v2.template at<typename T::elementType>(i);
+        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>((x - y) >> 1));
+    }
+}
+
+template<typename T>
+void test_vhsub_limits(T(*func)(T,T)) {
+    using E = typename T::elementType;
+    T v1, v2;
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<E>(i) = (i % 2) ? std::numeric_limits<E>::max() - i : std::numeric_limits<E>::min() + i;
+        v2.template at<E>(i) = (i % 3) ? std::numeric_limits<E>::max() - 2*i : std::numeric_limits<E>::min() + 3*i;
+    }
+    T result = func(v1,v2);
+    for(size_t i = 0; i < T::length; i++) {
+        int64_t x = v1.template at<E>(i);
+        int64_t y = v2.template at<E>(i);
+        assert(result.template at<E>(i) == static_cast<E>((x - y) >> 1));
     }
 }
 
@@ -32,4 +51,17 @@ int main() {
     test_vhsub(vhsubq_u8);
     test_vhsub(vhsubq_u16);
     test_vhsub(vhsubq_u32);
+
+    test_vhsub_limits(vhsub_s8);
+    test_vhsub_limits(vhsub_s16);
+    test_vhsub_limits(vhsub_s32);
+    test_vhsub_limits(vhsub_u8);
+    test_vhsub_limits(vhsub_u16);
+    test_vhsub_limits(vhsub_u32);
+    test_vhsub_limits(vhsubq_s8);
+    test_vhsub_limits(vhsubq_s16);
+    test_vhsub_limits(vhsubq_s32);
+    test_vhsub_limits(vhsubq_u8);
+    test_vhsub_limits(vhsubq_u16);
+    test_vhsub_limits(vhsubq_u32);
 }
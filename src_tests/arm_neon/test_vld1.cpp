@@ -11,7 +11,7 @@ void test_vld1(T(*func)(const typename T::elementType*)) {
 	}
 	T output = func(data);
 	for (size_t i = 0; i < T::length; i++) {
-		bool cmp = output.template at<typename T::elementType>(i) == 0;
+		bool cmp = output.template at<typename T::elementType>(i) == static_cast<typename T::elementType>(i);
 		assert(cmp);
 	}
 }
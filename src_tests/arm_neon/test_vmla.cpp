@@ -13,7 +13,7 @@ void test_vmla(T(*func)(T,T,T)){
     }
     T result = func(v1,v2,v3);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) = (i+1) * (T::length - i + 1) + (2*i));
+        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>((i+1) * (T::length - i + 1) + (2*i)));
     }
 
 }
@@ -14,7 +14,7 @@ void test_vmla_lane(T(*func)(T,T,T,int32_t)){
         }
         T result = func(v1,v2,v3,j);
         for(size_t i = 0; i < T::length; i++) {
-            assert(result.template at<typename T::elementType>(i) = (i+1) * (T::length - j + 1) + (2*i));
+            assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>((i+1) * (T::length - j + 1) + (2*i)));
         }
     }
 }
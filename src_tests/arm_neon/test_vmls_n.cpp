@@ -12,7 +12,7 @@ void test_vmls_n(T(*func)(T,T,typename T::elementType)){
     }
     T result = func(v1,v2,3);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) = (i+1) * static_cast<typename T::elementType>(3) - (2*i));
+        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>(static_cast<typename T::elementType>(2*i) - static_cast<typename T::elementType>(i+1) * static_cast<typename T::elementType>(3)));
     }
 }
 
@@ -4,17 +4,18 @@
 using namespace iris;
 
 template<typename T, typename R>
-void test_vmlsl(R(*func)(T,T,T)){
-    T v1, v2, v3;
+void test_vmlsl(R(*func)(R,T,T)){
+    R v1;
+    T v2, v3;
     for(size_t i = 0; i < T::length; i++) {
-        v1.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
+        v1.template at<typename R::elementType>(i) = i;
         v2.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
-        v3.template at<typename T::elementType>(i) = i;
+        v3.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
     }
     R result = func(v1,v2,v3);
     for(size_t i = 0; i < R::length; i++) {
         typename R::elementType x = static_cast<typename R::elementType>(std::numeric_limits<typename T::elementType>::max());
-        assert(result.template at<typename R::elementType>(i) = x * (1 + i));
+        assert(result.template at<typename R::elementType>(i) == static_cast<typename R::elementType>(static_cast<typename R::elementType>(i) - x * x));
     }
 
 }
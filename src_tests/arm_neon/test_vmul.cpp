@@ -12,7 +12,7 @@ void test_vmul(T(*func)(T,T)) {
     }
     T result = func(v1,v2);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) = (i + 1) * (T::length - 1));
+        assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>((i + 1) * (T::length - i)));
     }
 }
 
@@ -13,7 +13,7 @@ void test_vmul_lane(T(*func)(T,T,int32_t)) {
         }
         T result = func(v1,v2,j);
         for(size_t i = 0; i < T::length; i++) {
-            assert(result.template at<typename T::elementType>(i) = (i + 1) * (T::length - j));
+            assert(result.template at<typename T::elementType>(i) == static_cast<typename T::elementType>((i + 1) * (T::length - j)));
         }
     }
 }
@@ -13,10 +13,30 @@ void test_vmull(R(*func)(T,T)) {
     R result = func(v1,v2);
     for(size_t i = 0; i < T::length; i++) {
         const typename R::elementType max = static_cast<typename R::elementType>(std::numeric_limits<typename T::elementType>::max());
-        assert(result.template at<typename R::elementType>(i) = max * max);
+        assert(result.template at<typename R::elementType>(i) == static_cast<typename R::elementType>(max * max));
     }
 }
 
+template<typename T, typename R>
+void test_vmull_signs(R(*func)(T,T)) {
+    using E = typename T::elementType;
+    const E values[] = {std::numeric_limits<E>::min(), std::numeric_limits<E>::max(), static_cast<E>(-1), 0, 1, 3};
+    for(E x : values) {
+        for(E y : values) {
+            T v1, v2;
+            for(size_t i = 0; i < T::length; i++) {
+                v1.template at<E>(i) = x;
+                v2.template at<E>(i) = i % 2 ? y : x;
+            }
+            R result = func(v1,v2);
+            for(size_t i = 0; i < T::length; i++) {
+                const typename R::elementType a = x;
+                const typename R::elementType b = i % 2 ? y : x;
+                assert(result.template at<typename R::elementType>(i) == static_cast<typename R::elementType>(a * b));
+            }
+        }
+    }
+}
 
 int main() {
     test_vmull(vmull_s8);
@@ -26,4 +46,12 @@ int main() {
     test_vmull(vmull_u8);
     test_vmull(vmull_u16);
     test_vmull(vmull_u32);
+
+    test_vmull_signs(vmull_s8);
+    test_vmull_signs(vmull_s16);
+    test_vmull_signs(vmull_s32);
+
+    test_vmull_signs(vmull_u8);
+    test_vmull_signs(vmull_u16);
+    test_vmull_signs(vmull_u32);
 }
@@ -0,0 +1,95 @@
+#include <cassert>
+
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+
+template<typename T>
+T lanes(uint32_t seed) {
+    using E = typename T::elementType;
+    T v;
+    for(size_t i = 0; i < T::length; i++) {
+        next_seed(seed);
+        if constexpr (std::is_floating_point<E>::value) {
+            v.template at<E>(i) = static_cast<E>(static_cast<int32_t>(seed) >> 12) / 64;
+        } else if (seed % 5 == 0) {
+            v.template at<E>(i) = seed % 2 ? std::numeric_limits<E>::min() : std::numeric_limits<E>::max();
+        } else {
+            uint64_t bits = (uint64_t(seed) << 32) | (seed * 2654435761u);
+            v.template at<E>(i) = static_cast<E>(bits);
+        }
+    }
+    return v;
+}
+
+// the same sums in 64 bits (or float), truncated to the lane type
+template<typename T>
+void test_vpadd(T(*func)(T, T)) {
+    using E = typename T::elementType;
+    using W = typename std::conditional<std::is_floating_point<E>::value, E, uint64_t>::type;
+    for(uint32_t seed = 1; seed < 200; seed++) {
+        T a = lanes<T>(seed), b = lanes<T>(seed * 17 + 3);
+        T r = func(a, b);
+        const size_t half = T::length / 2;
+        for(size_t i = 0; i < half; i++) {
+            check(r.template at<E>(i) == static_cast<E>(W(a.template at<E>(2 * i)) + W(a.template at<E>(2 * i + 1))));
+            check(r.template at<E>(half + i) == static_cast<E>(W(b.template at<E>(2 * i)) + W(b.template at<E>(2 * i + 1))));
+        }
+    }
+}
+
+template<typename T, typename R>
+void test_vpaddl(R(*paddl)(T), R(*padal)(R, T)) {
+    using E = typename T::elementType;
+    using W = typename R::elementType;
+    for(uint32_t seed = 1; seed < 200; seed++) {
+        T v = lanes<T>(seed);
+        R acc = lanes<R>(seed * 29 + 1);
+        R x = paddl(v), y = padal(acc, v);
+        for(size_t i = 0; i < R::length; i++) {
+            W sum = static_cast<W>(v.template at<E>(2 * i)) + static_cast<W>(v.template at<E>(2 * i + 1));
+            check(x.template at<W>(i) == sum);
+            check(y.template at<W>(i) == static_cast<W>(static_cast<uint64_t>(acc.template at<W>(i)) + static_cast<uint64_t>(sum)));
+        }
+    }
+}
+
+// horizontal sum of 16 bytes without extracting lanes
+constexpr uint64x2_t total = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vdupq_n_u8(255))));
+static_assert(vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1) == 16 * 255, "vpaddlq chain");
+static_assert(vget_lane_s16(vpadd_s16(vdup_n_s16(-3), vdup_n_s16(5)), 3) == 10, "vpadd_s16");
+
+int main() {
+    test_vpadd(vpadd_u8);
+    test_vpadd(vpadd_u16);
+    test_vpadd(vpadd_u32);
+    test_vpadd(vpadd_s8);
+    test_vpadd(vpadd_s16);
+    test_vpadd(vpadd_s32);
+    test_vpadd(vpadd_f32);
+    test_vpadd(vpaddq_u8);
+    test_vpadd(vpaddq_u16);
+    test_vpadd(vpaddq_u32);
+    test_vpadd(vpaddq_u64);
+    test_vpadd(vpaddq_s8);
+    test_vpadd(vpaddq_s16);
+    test_vpadd(vpaddq_s32);
+    test_vpadd(vpaddq_s64);
+    test_vpadd(vpaddq_f32);
+
+    test_vpaddl(vpaddl_u8, vpadal_u8);
+    test_vpaddl(vpaddl_u16, vpadal_u16);
+    test_vpaddl(vpaddl_u32, vpadal_u32);
+    test_vpaddl(vpaddl_s8, vpadal_s8);
+    test_vpaddl(vpaddl_s16, vpadal_s16);
+    test_vpaddl(vpaddl_s32, vpadal_s32);
+    test_vpaddl(vpaddlq_u8, vpadalq_u8);
+    test_vpaddl(vpaddlq_u16, vpadalq_u16);
+    test_vpaddl(vpaddlq_u32, vpadalq_u32);
+    test_vpaddl(vpaddlq_s8, vpadalq_s8);
+    test_vpaddl(vpaddlq_s16, vpadalq_s16);
+    test_vpaddl(vpaddlq_s32, vpadalq_s32);
+}
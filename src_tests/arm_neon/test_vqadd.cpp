@@ -27,6 +27,31 @@ void test_vqadd(T(*func)(T,T)) {
 }
 
 
+template<typename T>
+void test_vqadd_mixed(T(*func)(T,T)) {
+    using E = typename T::elementType;
+    const E values[] = {std::numeric_limits<E>::min(), static_cast<E>(std::numeric_limits<E>::min() + 1), static_cast<E>(-1), 0, 1,
+                        static_cast<E>(std::numeric_limits<E>::max() / 2), static_cast<E>(std::numeric_limits<E>::max() - 1), std::numeric_limits<E>::max()};
+    const size_t count = sizeof(values) / sizeof(values[0]);
+    for(size_t offset = 0; offset < count * count; offset += T::length) {
+        T v1, v2;
+        for(size_t i = 0; i < T::length; i++) {
+            v1.template at<E>(i) = values[((offset + i) / count) % count];
+            v2.template at<E>(i) = values[(offset + i) % count];
+        }
+        T result = func(v1,v2);
+        for(size_t i = 0; i < T::length; i++) {
+            E x = v1.template at<E>(i);
+            E y = v2.template at<E>(i);
+            E expected;
+            if(__builtin_add_overflow(x, y, &expected)) {
+                expected = (std::is_signed<E>::value && y < 0) ? std::numeric_limits<E>::min() : std::numeric_limits<E>::max();
+            }
+            assert(result.template at<E>(i) == expected);
+        }
+    }
+}
+
 int main() {
     test_vqadd(vqadd_s8);
     test_vqadd(vqadd_s16);
@@ -47,4 +72,21 @@ int main() {
     test_vqadd(vqaddq_u16);
     test_vqadd(vqaddq_u32);
     test_vqadd(vqaddq_u64);
+
+    test_vqadd_mixed(vqadd_s8);
+    test_vqadd_mixed(vqadd_s16);
+    test_vqadd_mixed(vqadd_s32);
+    test_vqadd_mixed(vqadd_s64);
+    test_vqadd_mixed(vqadd_u8);
+    test_vqadd_mixed(vqadd_u16);
+    test_vqadd_mixed(vqadd_u32);
+    test_vqadd_mixed(vqadd_u64);
+    test_vqadd_mixed(vqaddq_s8);
+    test_vqadd_mixed(vqaddq_s16);
+    test_vqadd_mixed(vqaddq_s32);
+    test_vqadd_mixed(vqaddq_s64);
+    test_vqadd_mixed(vqaddq_u8);
+    test_vqadd_mixed(vqaddq_u16);
+    test_vqadd_mixed(vqaddq_u32);
+    test_vqadd_mixed(vqaddq_u64);
 }
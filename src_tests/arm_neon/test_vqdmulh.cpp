@@ -0,0 +1,100 @@
+#include <cassert>
+
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+
+// reference results in 64 bits; 2ab only overflows for min * min
+template<typename E>
+int64_t doubled(E a, E b) {
+    if(a == std::numeric_limits<E>::min() && b == std::numeric_limits<E>::min()) {
+        return sizeof(E) == 2 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int64_t>::max();
+    }
+    return 2 * static_cast<int64_t>(a) * b;
+}
+
+template<typename E>
+E high(E a, E b, bool rounding) {
+    constexpr int bits = sizeof(E) * 8;
+    if(a == std::numeric_limits<E>::min() && b == std::numeric_limits<E>::min()) {
+        return std::numeric_limits<E>::max();
+    }
+    return static_cast<E>((doubled(a, b) + (rounding ? int64_t(1) << (bits - 1) : 0)) >> bits);
+}
+
+template<typename T>
+T lanes(uint32_t seed) {
+    using E = typename T::elementType;
+    const E edges[] = {std::numeric_limits<E>::min(), static_cast<E>(std::numeric_limits<E>::min() + 1), std::numeric_limits<E>::max(), -1, 0, 1};
+    T v;
+    for(size_t i = 0; i < T::length; i++) {
+        next_seed(seed);
+        v.template at<E>(i) = seed % 3 == 0 ? edges[(seed >> 8) % 6] : static_cast<E>(static_cast<int32_t>(seed) >> (40 - sizeof(E) * 8));
+    }
+    return v;
+}
+
+template<typename T>
+void test_high(T(*qdmulh)(T, T), T(*qrdmulh)(T, T)) {
+    using E = typename T::elementType;
+    for(uint32_t seed = 1; seed < 400; seed++) {
+        T a = lanes<T>(seed), b = lanes<T>(seed * 31 + 7);
+        T x = qdmulh(a, b), y = qrdmulh(a, b);
+        for(size_t i = 0; i < T::length; i++) {
+            check(x.template at<E>(i) == high(a.template at<E>(i), b.template at<E>(i), false));
+            check(y.template at<E>(i) == high(a.template at<E>(i), b.template at<E>(i), true));
+        }
+    }
+}
+
+template<typename T, typename R>
+void test_long(R(*qdmull)(T, T), R(*qdmlal)(R, T, T)) {
+    using E = typename T::elementType;
+    using W = typename R::elementType;
+    for(uint32_t seed = 1; seed < 400; seed++) {
+        T a = lanes<T>(seed), b = lanes<T>(seed * 31 + 7);
+        R acc;
+        for(size_t i = 0; i < R::length; i++) {
+            acc.template at<W>(i) = seed % 2 ? std::numeric_limits<W>::max() - static_cast<W>(i) : static_cast<W>(seed * 1000 + i);
+        }
+        R x = qdmull(a, b), y = qdmlal(acc, a, b);
+        for(size_t i = 0; i < R::length; i++) {
+            W p = static_cast<W>(doubled(a.template at<E>(i), b.template at<E>(i)));
+            W sum;
+            if(__builtin_add_overflow(acc.template at<W>(i), p, &sum)) {
+                sum = p < 0 ? std::numeric_limits<W>::min() : std::numeric_limits<W>::max();
+            }
+            check(x.template at<W>(i) == p);
+            check(y.template at<W>(i) == sum);
+        }
+    }
+}
+
+// Q15: 0.5 * 0.5 = 0.25, and -1 * -1 saturates just below 1
+static_assert(vget_lane_s16(vqrdmulh_s16(vdup_n_s16(16384), vdup_n_s16(16384)), 0) == 8192, "vqrdmulh_s16");
+static_assert(vget_lane_s16(vqdmulh_s16(vdup_n_s16(-32768), vdup_n_s16(-32768)), 1) == 32767, "vqdmulh_s16");
+static_assert(vgetq_lane_s64(vqdmull_s32(vdup_n_s32(INT32_MIN), vdup_n_s32(INT32_MIN)), 0) == INT64_MAX, "vqdmull_s32");
+
+int main() {
+    test_high(vqdmulh_s16, vqrdmulh_s16);
+    test_high(vqdmulh_s32, vqrdmulh_s32);
+    test_high(vqdmulhq_s16, vqrdmulhq_s16);
+    test_high(vqdmulhq_s32, vqrdmulhq_s32);
+    test_long(vqdmull_s16, vqdmlal_s16);
+    test_long(vqdmull_s32, vqdmlal_s32);
+
+    int16x8_t a = vdupq_n_s16(12000);
+    int16x4_t v = vset_lane_s16(-20000, vdup_n_s16(3), 2);
+    check(vgetq_lane_s16(vqdmulhq_n_s16(a, -20000), 5) == high<int16_t>(12000, -20000, false));
+    check(vgetq_lane_s16(vqdmulhq_lane_s16(a, v, 2), 7) == high<int16_t>(12000, -20000, false));
+    check(vgetq_lane_s16(vqrdmulhq_n_s16(a, -20000), 0) == high<int16_t>(12000, -20000, true));
+    check(vgetq_lane_s16(vqrdmulhq_lane_s16(a, v, 2), 3) == high<int16_t>(12000, -20000, true));
+    check(vget_lane_s32(vqrdmulh_lane_s32(vdup_n_s32(1 << 30), vdup_n_s32(-(1 << 29)), 1), 0) == -(1 << 28));
+    check(vgetq_lane_s32(vqdmull_n_s16(vget_low_s16(a), 3), 1) == 72000);
+    check(vgetq_lane_s32(vqdmull_lane_s16(vget_low_s16(a), v, 2), 2) == -480000000);
+    check(vgetq_lane_s32(vqdmlal_n_s16(vdupq_n_s32(5), vget_low_s16(a), 3), 3) == 72005);
+    check(vgetq_lane_s64(vqdmlal_lane_s32(vdupq_n_s64(INT64_MAX), vdup_n_s32(7), vdup_n_s32(1), 0), 0) == INT64_MAX);
+}
@@ -27,7 +27,7 @@ void test_vqneg(T(*func)(T)) {
     typename T::elementType p = result.template at<typename T::elementType>(0);
     std::cout << "Original: " << std::to_string(v.template at<typename T::elementType>(0)) << std::endl;
     std::cout << "P: " << std::to_string(p) << std::endl;
-    assert(p == -std::numeric_limits<typename T::elementType>::max());
+    assert(p == std::numeric_limits<typename T::elementType>::max());
     for(size_t i = 1; i < T::length; i++) {
         typename T::elementType x = v.template at<typename T::elementType>(i) * (typename T::elementType)-1 ;
         typename T::elementType y = result.template at<typename T::elementType>(i);
@@ -44,6 +44,31 @@ void test_vqsub(T(*func)(T,T)) {
 }
 
 
+template<typename T>
+void test_vqsub_mixed(T(*func)(T,T)) {
+    using E = typename T::elementType;
+    const E values[] = {std::numeric_limits<E>::min(), static_cast<E>(std::numeric_limits<E>::min() + 1), static_cast<E>(-1), 0, 1,
+                        static_cast<E>(std::numeric_limits<E>::max() / 2), static_cast<E>(std::numeric_limits<E>::max() - 1), std::numeric_limits<E>::max()};
+    const size_t count = sizeof(values) / sizeof(values[0]);
+    for(size_t offset = 0; offset < count * count; offset += T::length) {
+        T v1, v2;
+        for(size_t i = 0; i < T::length; i++) {
+            v1.template at<E>(i) = values[((offset + i) / count) % count];
+            v2.template at<E>(i) = values[(offset + i) % count];
+        }
+        T result = func(v1,v2);
+        for(size_t i = 0; i < T::length; i++) {
+            E x = v1.template at<E>(i);
+            E y = v2.template at<E>(i);
+            E expected;
+            if(__builtin_sub_overflow(x, y, &expected)) {
+                expected = (std::is_signed<E>::value && y < 0) ? std::numeric_limits<E>::max() : std::numeric_limits<E>::min();
+            }
+            assert(result.template at<E>(i) == expected);
+        }
+    }
+}
+
 int main() {
     test_vqsub(vqsub_s8);
     test_vqsub(vqsub_s16);
@@ -64,4 +89,21 @@ int main() {
     test_vqsub(vqsubq_u16);
     test_vqsub(vqsubq_u32);
     test_vqsub(vqsubq_u64);
+
+    test_vqsub_mixed(vqsub_s8);
+    test_vqsub_mixed(vqsub_s16);
+    test_vqsub_mixed(vqsub_s32);
+    test_vqsub_mixed(vqsub_s64);
+    test_vqsub_mixed(vqsub_u8);
+    test_vqsub_mixed(vqsub_u16);
+    test_vqsub_mixed(vqsub_u32);
+    test_vqsub_mixed(vqsub_u64);
+    test_vqsub_mixed(vqsubq_s8);
+    test_vqsub_mixed(vqsubq_s16);
+    test_vqsub_mixed(vqsubq_s32);
+    test_vqsub_mixed(vqsubq_s64);
+    test_vqsub_mixed(vqsubq_u8);
+    test_vqsub_mixed(vqsubq_u16);
+    test_vqsub_mixed(vqsubq_u32);
+    test_vqsub_mixed(vqsubq_u64);
 }
@@ -24,13 +24,32 @@ void test_vraddhn(R(*func)(T,T)) {
     for(size_t i = 0; i < T::length; i++) {
         assert(result.template at<typename R::elementType>(i) == std::numeric_limits<typename R::elementType>::min());
     }
+    // the sum wraps like vadd before the high half is taken
     for(size_t i = 0; i < T::length; i++) {
         v1.template at<typename T::elementType>(i) = std::numeric_limits<typename T::elementType>::max();
         v2.template at<typename T::elementType>(i) = 1;
     }
     result = func(v1,v2);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename R::elementType>(i) == std::numeric_limits<typename R::elementType>::max());
+        assert(result.template at<typename R::elementType>(i) == (std::numeric_limits<typename R::elementType>::is_signed ? std::numeric_limits<typename R::elementType>::min() : 0));
+    }
+    // half of the dropped low part rounds up
+    const size_t half = sizeof(typename R::elementType) * 8;
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<typename T::elementType>(i) = static_cast<typename T::elementType>(1) << (half - 1);
+        v2.template at<typename T::elementType>(i) = static_cast<typename T::elementType>(i);
+    }
+    result = func(v1,v2);
+    for(size_t i = 0; i < T::length; i++) {
+        assert(result.template at<typename R::elementType>(i) == 1);
+    }
+    for(size_t i = 0; i < T::length; i++) {
+        v1.template at<typename T::elementType>(i) = (static_cast<typename T::elementType>(1) << (half - 1)) - 1;
+        v2.template at<typename T::elementType>(i) = 0;
+    }
+    result = func(v1,v2);
+    for(size_t i = 0; i < T::length; i++) {
+        assert(result.template at<typename R::elementType>(i) == 0);
     }
 }
 
@@ -0,0 +1,134 @@
+#include <cassert>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+using namespace iris::arm;
+
+uint32_t bits(float x) {
+    uint32_t b;
+    std::memcpy(&b, &x, sizeof(b));
+    return b;
+}
+
+float from_bits(uint32_t b) {
+    float x;
+    std::memcpy(&x, &b, sizeof(x));
+    return x;
+}
+
+// specials, denormals and every exponent, then pseudo-random bit patterns
+uint32_t pattern(uint32_t j, uint32_t &seed) {
+    static const uint32_t special[] = {
+        0x00000000, 0x80000000, 0x7f800000, 0xff800000, 0x7fc00000, 0x7f800001, 0xffc00123, 0xff800042,
+        0x00000001, 0x00100000, 0x00200000, 0x00400000, 0x007fffff, 0x80200001, 0x80400000, 0x807fffff,
+        0x00800000, 0x7e000000, 0x7e7fffff, 0x7e800000, 0x7f000000, 0x7f7fffff, 0xff7fffff, 0xfe800000,
+    };
+    const uint32_t count = sizeof(special) / sizeof(special[0]);
+    if(j < count) {
+        return special[j];
+    }
+    if(j < count + 512) {
+        return (j - count) << 23 | ((j * 0x9e3779b9u) & 0x7fffff);
+    }
+    next_seed(seed);
+    return seed ^ (seed << 13);
+}
+
+template<typename T>
+T make(uint32_t base, uint32_t &seed) {
+    T v;
+    for(size_t i = 0; i < T::length; i++) {
+        uint32_t b = pattern(base + static_cast<uint32_t>(i), seed);
+        std::memcpy(&v.template at<typename T::elementType>(i), &b, sizeof(b));
+    }
+    return v;
+}
+
+template<typename T, typename B1, typename B2>
+void cross_check() {
+    uint32_t seed = 1;
+    for(uint32_t base = 0; base < 100000; base += T::length) {
+        T v1 = make<T>(base, seed);
+        T v2 = make<T>(base + 7, seed);
+        assert_same(values::__vrecpe<T, B1>(v1), values::__vrecpe<T, B2>(v1));
+        assert_same(values::__vrsqrte<T, B1>(v1), values::__vrsqrte<T, B2>(v1));
+        if constexpr (std::is_floating_point<typename T::elementType>::value) {
+            assert_same(values::__vrecps<T, B1>(v1, v2), values::__vrecps<T, B2>(v1, v2));
+            assert_same(values::__vrsqrts<T, B1>(v1, v2), values::__vrsqrts<T, B2>(v1, v2));
+        }
+    }
+}
+
+float recpe(float x) {
+    return vgetq_lane_f32(vrecpeq_f32(vdupq_n_f32(x)), 0);
+}
+
+float rsqrte(float x) {
+    return vgetq_lane_f32(vrsqrteq_f32(vdupq_n_f32(x)), 0);
+}
+
+int main() {
+    // values read back from Cortex-A cores
+    check(bits(recpe(1.0f)) == 0x3f7f8000);
+    check(recpe(2.0f) == 0.4990234375f);
+    check(recpe(3.0f) == 0.3330078125f);
+    check(recpe(-1.0f) == -0.998046875f);
+    check(bits(recpe(std::numeric_limits<float>::max())) == 0x00200000);
+    check(bits(recpe(0.0f)) == 0x7f800000);
+    check(bits(recpe(-0.0f)) == 0xff800000);
+    check(bits(recpe(-std::numeric_limits<float>::infinity())) == 0x80000000);
+    check(bits(recpe(from_bits(0x7f800001))) == 0x7fc00001);
+    check(bits(rsqrte(1.0f)) == 0x3f7f8000);
+    check(rsqrte(2.0f) == 0.705078125f);
+    check(rsqrte(4.0f) == 0.4990234375f);
+    check(bits(rsqrte(-1.0f)) == 0x7fc00000);
+    check(bits(rsqrte(-0.0f)) == 0xff800000);
+    check(bits(rsqrte(std::numeric_limits<float>::infinity())) == 0);
+
+    check(vgetq_lane_u32(vrecpeq_u32(vdupq_n_u32(0x80000000u)), 0) == 0xff800000u);
+    check(vgetq_lane_u32(vrecpeq_u32(vdupq_n_u32(0x7fffffffu)), 0) == 0xffffffffu);
+    check(vgetq_lane_u32(vrsqrteq_u32(vdupq_n_u32(0x3fffffffu)), 0) == 0xffffffffu);
+    check(vget_lane_u32(vrsqrte_u32(vdup_n_u32(0x40000000u)), 1) == 0xff800000u);
+
+    // infinity times zero, and NaN operands keep their payload
+    check(vgetq_lane_f32(vrecpsq_f32(vdupq_n_f32(std::numeric_limits<float>::infinity()), vdupq_n_f32(0.0f)), 0) == 2.0f);
+    check(vget_lane_f32(vrsqrts_f32(vdup_n_f32(0.0f), vdup_n_f32(-std::numeric_limits<float>::infinity())), 1) == 1.5f);
+    check(bits(vgetq_lane_f32(vrecpsq_f32(vdupq_n_f32(from_bits(0x7f800005)), vdupq_n_f32(1.0f)), 0)) == 0xffc00005);
+
+    // (3 - a * b) / 2 is rounded once: products between 2^128 and 2^129 stay finite
+    check(bits(vgetq_lane_f32(vrsqrtsq_f32(vdupq_n_f32(0x1p64f), vdupq_n_f32(0x1p64f)), 3)) == 0xff000000);
+    check(bits(vget_lane_f32(vrsqrts_f32(vdup_n_f32(0x1.8p63f), vdup_n_f32(0x1.8p64f)), 0)) == 0xff100000);
+    check(bits(vgetq_lane_f32(vrsqrtsq_f32(vdupq_n_f32(0x1p100f), vdupq_n_f32(0x1p28f)), 1)) == 0xff000000);
+    check(bits(vgetq_lane_f32(vrsqrtsq_f32(vdupq_n_f32(-0x1p28f), vdupq_n_f32(0x1p100f)), 2)) == 0x7f000000);
+    check(bits(vgetq_lane_f32(vrsqrtsq_f32(vdupq_n_f32(0x1p65f), vdupq_n_f32(0x1p64f)), 0)) == 0xff800000);
+    check(bits(vget_lane_f32(vrecps_f32(vdup_n_f32(0x1p64f), vdup_n_f32(0x1p64f)), 1)) == 0xff800000);
+
+    // two Newton steps from the estimate reach single precision
+    for(float x : {0.3f, 1.0f, 7.5f, 1234.5f, 3.0e-30f, -9.0e20f}) {
+        float32x4_t v = vdupq_n_f32(x);
+        float32x4_t r = vrecpeq_f32(v);
+        r = vmulq_f32(r, vrecpsq_f32(v, r));
+        r = vmulq_f32(r, vrecpsq_f32(v, r));
+        check(std::fabs(vgetq_lane_f32(r, 2) * x - 1.0f) < 1e-6f);
+        if(x > 0) {
+            float32x4_t s = vrsqrteq_f32(v);
+            s = vmulq_f32(s, vrsqrtsq_f32(vmulq_f32(v, s), s));
+            s = vmulq_f32(s, vrsqrtsq_f32(vmulq_f32(v, s), s));
+            check(std::fabs(vgetq_lane_f32(s, 1) * std::sqrt(x) - 1.0f) < 1e-6f);
+        }
+    }
+
+    cross_check<float32x4_t, backend::scalar, backend::sse2>();
+    cross_check<float32x2_t, backend::scalar, backend::sse2>();
+    cross_check<float32x4_t, backend::scalar, backend::avx2>();
+    cross_check<float32x2_t, backend::scalar, backend::best>();
+    cross_check<uint32x4_t, backend::scalar, backend::sse2>();
+    cross_check<uint32x2_t, backend::scalar, backend::best>();
+}
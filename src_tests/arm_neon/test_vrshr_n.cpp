@@ -1,47 +1,49 @@
 #include <iris/iris.h>
 #include <iostream>
 #include <numeric>
+#include <limits>
 #include <cassert>
 
 using namespace iris;
 
+// (x + 2^(n-1)) >> n in a wider type; 64-bit lanes take the floor of
+// x / 2^n and round up when the remainder is at least 2^(n-1)
+template<typename E>
+E rounding_shift(E x, uint32_t n) {
+    if constexpr (sizeof(E) < 8) {
+        using W = typename std::conditional<std::is_signed<E>::value, int64_t, uint64_t>::type;
+        return static_cast<E>((static_cast<W>(x) + (W(1) << (n - 1))) >> n);
+    } else {
+        uint64_t bits = static_cast<uint64_t>(x);
+        uint64_t remainder = n == 64 ? bits : bits & ((uint64_t(1) << n) - 1);
+        E floor = n < 64 ? static_cast<E>(x >> n) : static_cast<E>(std::is_signed<E>::value && (bits >> 63) ? -1 : 0);
+        return static_cast<E>(floor + (remainder >= (uint64_t(1) << (n - 1)) ? 1 : 0));
+    }
+}
 
-template<typename T, size_t VectorLength = T::length, typename ElementType = typename T::elementType, size_t ElementSize = T::elementSize>
+template<typename T, typename ElementType = typename T::elementType, size_t ElementSize = T::elementSize>
 void test_vrshr_n(T(*func)(T,uint32_t)) {
-    T v;
-    for(size_t i = 0; i < T::length; i++) {
-        v.template at<ElementType>(i) = i;
-    }
-    for(size_t i = 0; i < ElementSize; i++) {
-        T result = func(v,i);
+    const ElementType values[] = {
+        0, 1, 2, 3, 5, 9, 100,
+        std::numeric_limits<ElementType>::max(),
+        static_cast<ElementType>(std::numeric_limits<ElementType>::max() - 1),
+        std::numeric_limits<ElementType>::min(),
+        static_cast<ElementType>(std::numeric_limits<ElementType>::min() + 1),
+        static_cast<ElementType>(-1), static_cast<ElementType>(-9), static_cast<ElementType>(-21973),
+    };
+    const size_t count = sizeof(values) / sizeof(values[0]);
+    for(size_t base = 0; base < count; base += T::length) {
+        T v;
         for(size_t j = 0; j < T::length; j++) {
-            std::cout << "Actual: " << std::to_string(result.template at<ElementType>(j)) << std::endl;
-            ElementType expected = (ElementType)(j + (j % 2 == 0 ? 0 : 1)) >> i;
-            std::cout << "Expected: " << std::to_string(expected) << std::endl;
-            assert(result.template at<ElementType>(j) == expected);
+            v.template at<ElementType>(j) = values[(base + j) % count];
         }
-    }
-    std::cout << std::endl;
-    if(std::numeric_limits<ElementType>::is_signed) {
-        for(size_t i = 0; i < T::length; i++) {
-            ElementType x = -((ElementType)i);
-            std::cout << std::to_string(x) << std::endl;
-            v.template at<ElementType>(i) = x;
-        }
-        for(size_t i = 0; i < ElementSize; i++) {
-            T result = func(v,i);
+        for(uint32_t n = 1; n <= ElementSize; n++) {
+            T result = func(v, n);
             for(size_t j = 0; j < T::length; j++) {
-                std::cout << "Original: " << std::to_string(v.template at<ElementType>(j)) << std::endl;
-                std::cout << "Actual: " << std::to_string(result.template at<ElementType>(j)) << std::endl;
-                ElementType x = -((ElementType)j);
-                ElementType expected = (x + (x % 2 == 0 ? 0 : 1)) >> i;
-                std::cout << "Expected: " << std::to_string(expected) << std::endl;
-                assert(result.template at<ElementType>(j) == expected);
+                assert(result.template at<ElementType>(j) == rounding_shift(v.template at<ElementType>(j), n));
             }
         }
     }
-    
-    std::cout << std::endl;
 }
 
 
@@ -55,7 +57,7 @@ int main() {
     test_vrshr_n(vrshr_n_u16);
     test_vrshr_n(vrshr_n_u32);
     test_vrshr_n(vrshr_n_u64);
-    std::cout << "Quads" << std::endl;
+
     test_vrshr_n(vrshrq_n_s8);
     test_vrshr_n(vrshrq_n_s16);
     test_vrshr_n(vrshrq_n_s32);
@@ -65,4 +67,7 @@ int main() {
     test_vrshr_n(vrshrq_n_u16);
     test_vrshr_n(vrshrq_n_u32);
     test_vrshr_n(vrshrq_n_u64);
+
+    assert(vgetq_lane_s16(vrshrq_n_s16(vdupq_n_s16(32767), 3), 0) == 4096);
+    assert(vgetq_lane_s16(vrshrq_n_s16(vdupq_n_s16(-21973), 3), 5) == -2747);
 }
@@ -0,0 +1,50 @@
+#include <iris/iris.h>
+#include <cassert>
+
+using namespace iris;
+
+template<typename T>
+void test_vst2(void(*func)(typename T::vectorType::elementType*,T)) {
+	constexpr size_t elementCount = T::lanes * T::vectorType::length;
+	typename T::vectorType::elementType data[elementCount + 1];
+	T v;
+	for (size_t i = 0; i < T::lanes; i++) {
+		for (size_t j = 0; j < T::vectorType::length; j++) {
+			v.val[i].template at<typename T::vectorType::elementType>(j) = i + T::lanes * j;
+		}
+	}
+	for (size_t i = 0; i <= elementCount; i++) {
+		data[i] = 47;
+	}
+	func(data,v);
+	for (size_t i = 0; i < elementCount; i++) {
+		assert(data[i] == static_cast<typename T::vectorType::elementType>(i));
+	}
+	assert(data[elementCount] == 47);
+}
+
+int main() {
+	test_vst2<int8x8x2_t>(vst2_s8);
+	test_vst2<int16x4x2_t>(vst2_s16);
+	test_vst2<int32x2x2_t>(vst2_s32);
+	test_vst2<int64x1x2_t>(vst2_s64);
+
+	test_vst2<uint8x8x2_t>(vst2_u8);
+	test_vst2<uint16x4x2_t>(vst2_u16);
+	test_vst2<uint32x2x2_t>(vst2_u32);
+	test_vst2<uint64x1x2_t>(vst2_u64);
+
+	test_vst2<float32x2x2_t>(vst2_f32);
+
+	test_vst2<int8x16x2_t>(vst2q_s8);
+	test_vst2<int16x8x2_t>(vst2q_s16);
+	test_vst2<int32x4x2_t>(vst2q_s32);
+	test_vst2<int64x2x2_t>(vst2q_s64);
+
+	test_vst2<uint8x16x2_t>(vst2q_u8);
+	test_vst2<uint16x8x2_t>(vst2q_u16);
+	test_vst2<uint32x4x2_t>(vst2q_u32);
+	test_vst2<uint64x2x2_t>(vst2q_u64);
+
+	test_vst2<float32x4x2_t>(vst2q_f32);
+}
@@ -0,0 +1,50 @@
+#include <iris/iris.h>
+#include <cassert>
+
+using namespace iris;
+
+template<typename T>
+void test_vst3(void(*func)(typename T::vectorType::elementType*,T)) {
+	constexpr size_t elementCount = T::lanes * T::vectorType::length;
+	typename T::vectorType::elementType data[elementCount + 1];
+	T v;
+	for (size_t i = 0; i < T::lanes; i++) {
+		for (size_t j = 0; j < T::vectorType::length; j++) {
+			v.val[i].template at<typename T::vectorType::elementType>(j) = i + T::lanes * j;
+		}
+	}
+	for (size_t i = 0; i <= elementCount; i++) {
+		data[i] = 47;
+	}
+	func(data,v);
+	for (size_t i = 0; i < elementCount; i++) {
+		assert(data[i] == static_cast<typename T::vectorType::elementType>(i));
+	}
+	assert(data[elementCount] == 47);
+}
+
+int main() {
+	test_vst3<int8x8x3_t>(vst3_s8);
+	test_vst3<int16x4x3_t>(vst3_s16);
+	test_vst3<int32x2x3_t>(vst3_s32);
+	test_vst3<int64x1x3_t>(vst3_s64);
+
+	test_vst3<uint8x8x3_t>(vst3_u8);
+	test_vst3<uint16x4x3_t>(vst3_u16);
+	test_vst3<uint32x2x3_t>(vst3_u32);
+	test_vst3<uint64x1x3_t>(vst3_u64);
+
+	test_vst3<float32x2x3_t>(vst3_f32);
+
+	test_vst3<int8x16x3_t>(vst3q_s8);
+	test_vst3<int16x8x3_t>(vst3q_s16);
+	test_vst3<int32x4x3_t>(vst3q_s32);
+	test_vst3<int64x2x3_t>(vst3q_s64);
+
+	test_vst3<uint8x16x3_t>(vst3q_u8);
+	test_vst3<uint16x8x3_t>(vst3q_u16);
+	test_vst3<uint32x4x3_t>(vst3q_u32);
+	test_vst3<uint64x2x3_t>(vst3q_u64);
+
+	test_vst3<float32x4x3_t>(vst3q_f32);
+}
@@ -0,0 +1,47 @@
+#include <iris/iris.h>
+#include <cassert>
+
+using namespace iris;
+
+template <typename T>
+void test_vst3_lane(void(*func)(typename T::vectorType::elementType*,T,int32_t)){
+    typename T::vectorType::elementType data[T::lanes + 1];
+    T v;
+    for(size_t i = 0; i < T::lanes; i++) {
+        for(size_t j = 0; j < T::vectorType::length; j++) {
+            v.val[i].template at<typename T::vectorType::elementType>(j) = static_cast<typename T::vectorType::elementType>(i * T::vectorType::length + j);
+        }
+    }
+    for(size_t j = 0; j < T::vectorType::length; j++) {
+        for(size_t i = 0; i <= T::lanes; i++) {
+            data[i] = 47;
+        }
+        func(data,v,j);
+        for(size_t i = 0; i < T::lanes; i++) {
+            assert(data[i] == static_cast<typename T::vectorType::elementType>(i * T::vectorType::length + j));
+        }
+        assert(data[T::lanes] == 47);
+    }
+}
+
+int main() {
+    test_vst3_lane<uint8x8x3_t>(vst3_lane_u8);
+    test_vst3_lane<uint16x4x3_t>(vst3_lane_u16);
+    test_vst3_lane<uint32x2x3_t>(vst3_lane_u32);
+
+    test_vst3_lane<int8x8x3_t>(vst3_lane_s8);
+    test_vst3_lane<int16x4x3_t>(vst3_lane_s16);
+    test_vst3_lane<int32x2x3_t>(vst3_lane_s32);
+
+    test_vst3_lane<float32x2x3_t>(vst3_lane_f32);
+
+    test_vst3_lane<uint8x16x3_t>(vst3q_lane_u8);
+    test_vst3_lane<uint16x8x3_t>(vst3q_lane_u16);
+    test_vst3_lane<uint32x4x3_t>(vst3q_lane_u32);
+
+    test_vst3_lane<int8x16x3_t>(vst3q_lane_s8);
+    test_vst3_lane<int16x8x3_t>(vst3q_lane_s16);
+    test_vst3_lane<int32x4x3_t>(vst3q_lane_s32);
+
+    test_vst3_lane<float32x4x3_t>(vst3q_lane_f32);
+}
@@ -0,0 +1,50 @@
+#include <iris/iris.h>
+#include <cassert>
+
+using namespace iris;
+
+template<typename T>
+void test_vst4(void(*func)(typename T::vectorType::elementType*,T)) {
+	constexpr size_t elementCount = T::lanes * T::vectorType::length;
+	typename T::vectorType::elementType data[elementCount + 1];
+	T v;
+	for (size_t i = 0; i < T::lanes; i++) {
+		for (size_t j = 0; j < T::vectorType::length; j++) {
+			v.val[i].template at<typename T::vectorType::elementType>(j) = i + T::lanes * j;
+		}
+	}
+	for (size_t i = 0; i <= elementCount; i++) {
+		data[i] = 47;
+	}
+	func(data,v);
+	for (size_t i = 0; i < elementCount; i++) {
+		assert(data[i] == static_cast<typename T::vectorType::elementType>(i));
+	}
+	assert(data[elementCount] == 47);
+}
+
+int main() {
+	test_vst4<int8x8x4_t>(vst4_s8);
+	test_vst4<int16x4x4_t>(vst4_s16);
+	test_vst4<int32x2x4_t>(vst4_s32);
+	test_vst4<int64x1x4_t>(vst4_s64);
+
+	test_vst4<uint8x8x4_t>(vst4_u8);
+	test_vst4<uint16x4x4_t>(vst4_u16);
+	test_vst4<uint32x2x4_t>(vst4_u32);
+	test_vst4<uint64x1x4_t>(vst4_u64);
+
+	test_vst4<float32x2x4_t>(vst4_f32);
+
+	test_vst4<int8x16x4_t>(vst4q_s8);
+	test_vst4<int16x8x4_t>(vst4q_s16);
+	test_vst4<int32x4x4_t>(vst4q_s32);
+	test_vst4<int64x2x4_t>(vst4q_s64);
+
+	test_vst4<uint8x16x4_t>(vst4q_u8);
+	test_vst4<uint16x8x4_t>(vst4q_u16);
+	test_vst4<uint32x4x4_t>(vst4q_u32);
+	test_vst4<uint64x2x4_t>(vst4q_u64);
+
+	test_vst4<float32x4x4_t>(vst4q_f32);
+}
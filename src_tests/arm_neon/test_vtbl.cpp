@@ -0,0 +1,68 @@
+#include <cassert>
+
+#include <numeric>
+#include <iostream>
+
+#include <iris/iris.h>
+#include "test_helpers.h"
+using namespace iris;
+using namespace iris::arm;
+
+// every index 0..255 through the best kernel, against the byte it names
+template<typename R, typename Table, typename I>
+void test_lookup(R(*tbl)(Table, I), R(*tbx)(R, Table, I), Table t, size_t size) {
+    using E = typename R::elementType;
+    R fallback = random_lanes<R>(99);
+    for(size_t base = 0; base < 256; base += R::length) {
+        I idx;
+        for(size_t i = 0; i < R::length; i++) {
+            idx.template at<typename I::elementType>(i) = static_cast<typename I::elementType>(base + i);
+        }
+        R looked = tbl(t, idx);
+        R extended = tbx(fallback, t, idx);
+        assert_same(looked, table::__vtbl<R, Table, I, backend::scalar>(t, idx));
+        for(size_t i = 0; i < R::length; i++) {
+            size_t j = base + i;
+            E expected = j < size ? table::__table_byte(t, j) : 0;
+            check(looked.template at<E>(i) == expected);
+            check(extended.template at<E>(i) == (j < size ? expected : fallback.template at<E>(i)));
+        }
+    }
+}
+
+template<typename V, size_t n>
+iris::common::multi_vector<V, n> registers() {
+    iris::common::multi_vector<V, n> t;
+    for(size_t k = 0; k < n; k++) {
+        t.val[k] = random_lanes<V>(static_cast<uint32_t>(k + 1));
+    }
+    return t;
+}
+
+// vqtbl1q_u8 as a 16-entry lookup table, e.g. hex digits
+constexpr uint8x16_t hex() {
+    uint8x16_t t;
+    for(size_t i = 0; i < 16; i++) {
+        t.at(i) = static_cast<uint8_t>("0123456789abcdef"[i]);
+    }
+    return t;
+}
+constexpr uint8x16_t digits = vqtbl1q_u8(hex(), vsetq_lane_u8(15, vsetq_lane_u8(10, vsetq_lane_u8(9, vdupq_n_u8(0), 1), 2), 3));
+static_assert(vgetq_lane_u8(digits, 0) == '0' && vgetq_lane_u8(digits, 1) == '9' && vgetq_lane_u8(digits, 2) == 'a' && vgetq_lane_u8(digits, 3) == 'f', "vqtbl1q_u8");
+
+int main() {
+    test_lookup(vtbl1_u8, vtbx1_u8, random_lanes<uint8x8_t>(1), 8);
+    test_lookup(vtbl2_u8, vtbx2_u8, registers<uint8x8_t, 2>(), 16);
+    test_lookup(vtbl3_u8, vtbx3_u8, registers<uint8x8_t, 3>(), 24);
+    test_lookup(vtbl4_u8, vtbx4_u8, registers<uint8x8_t, 4>(), 32);
+    test_lookup(vtbl1_s8, vtbx1_s8, random_lanes<int8x8_t>(2), 8);
+    test_lookup(vtbl3_s8, vtbx3_s8, registers<int8x8_t, 3>(), 24);
+
+    test_lookup(vqtbl1_u8, vqtbx1_u8, random_lanes<uint8x16_t>(3), 16);
+    test_lookup(vqtbl2_s8, vqtbx2_s8, registers<int8x16_t, 2>(), 32);
+    test_lookup(vqtbl1q_u8, vqtbx1q_u8, random_lanes<uint8x16_t>(4), 16);
+    test_lookup(vqtbl2q_u8, vqtbx2q_u8, registers<uint8x16_t, 2>(), 32);
+    test_lookup(vqtbl3q_u8, vqtbx3q_u8, registers<uint8x16_t, 3>(), 48);
+    test_lookup(vqtbl4q_u8, vqtbx4q_u8, registers<uint8x16_t, 4>(), 64);
+    test_lookup(vqtbl4q_s8, vqtbx4q_s8, registers<int8x16_t, 4>(), 64);
+}
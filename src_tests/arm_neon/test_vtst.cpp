@@ -11,9 +11,9 @@ void test_vtst(R(*func)(T,T)) {
         v1.template at<typename T::elementType>(i) = 1;
         v2.template at<typename T::elementType>(i) = 2;
     }
-    T result = func(v1,v2);
+    R result = func(v1,v2);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) == 0);
+        assert(result.template at<typename R::elementType>(i) == 0);
     }
     for(size_t i = 0; i < T::length; i++) {
         v1.template at<typename T::elementType>(i) = 46;
@@ -21,7 +21,7 @@ void test_vtst(R(*func)(T,T)) {
     }
     result = func(v1,v2);
     for(size_t i = 0; i < T::length; i++) {
-        assert(result.template at<typename T::elementType>(i) == 1);
+        assert(result.template at<typename R::elementType>(i) == std::numeric_limits<typename R::elementType>::max());
     }
 }
 
@@ -0,0 +1,14 @@
+// Callers of intrinsics backed by SSE and GNU vector kernels; checked by the
+// check_inlining target (check.cmake), which reads the assembly of every
+// iris_call_* function.
+#include <iris/iris.h>
+using namespace iris;
+
+extern "C" {
+
+int8x16_t iris_call_vaddq_s8(int8x16_t a, int8x16_t b) { return vaddq_s8(a, b); }
+int16x8_t iris_call_vsubq_s16(int16x8_t a, int16x8_t b) { return vsubq_s16(a, b); }
+int32x4_t iris_call_vmulq_s32(int32x4_t a, int32x4_t b) { return vmulq_s32(a, b); }
+uint8x16_t iris_call_vcntq_u8(uint8x16_t a) { return vcntq_u8(a); }
+
+}
@@ -0,0 +1,49 @@
+# Compiles callers.cpp at -O0 and -Og and fails when an iris_call_* function
+# calls into a backend kernel or helper. At -O0 the intrinsic is inlined
+# too, so no call is left at all; at -Og GCC may keep the call to the
+# intrinsic itself, with the kernel inlined into it.
+#
+# cmake -DCXX=<g++> -DINCLUDE=<include dir> -DBINARY_DIR=<dir> -P check.cmake
+
+set(SOURCE ${CMAKE_CURRENT_LIST_DIR}/callers.cpp)
+
+set(CHECKED 0)
+set(FAILED 0)
+foreach(LEVEL -O0 -Og)
+    set(ASM ${BINARY_DIR}/callers${LEVEL}.s)
+    execute_process(
+        COMMAND ${CXX} -std=c++1z ${LEVEL} -DIRIS_ARM_NEON=1 -I${INCLUDE}
+                -S ${SOURCE} -o ${ASM}
+        RESULT_VARIABLE COMPILE_RESULT)
+    if(NOT COMPILE_RESULT EQUAL 0)
+        message(FATAL_ERROR "check_inlining: ${SOURCE} does not compile at ${LEVEL}")
+    endif()
+
+    # ';' separates CMake list items, so it is dropped before splitting; labels
+    # are matched at the start of a line, past _GLOBAL__sub_I_iris_call_*
+    file(READ ${ASM} CONTENT)
+    string(REPLACE ";" "" CONTENT "${CONTENT}")
+    string(REGEX MATCHALL "\niris_call_[A-Za-z0-9_]*:|\\.cfi_endproc|\tcall\t[^\n]*" LINES "${CONTENT}")
+
+    set(FUNCTION "")
+    foreach(LINE IN LISTS LINES)
+        if(LINE MATCHES "^\n(iris_call_[A-Za-z0-9_]*):")
+            set(FUNCTION "${CMAKE_MATCH_1}")
+            math(EXPR CHECKED "${CHECKED} + 1")
+        elseif(LINE STREQUAL ".cfi_endproc")
+            set(FUNCTION "")
+        elseif(FUNCTION AND (LEVEL STREQUAL "-O0" OR LINE MATCHES "N4iris3arm3(sse|gnu)"))
+            string(REGEX REPLACE "^\tcall\t" "" TARGET "${LINE}")
+            message("${FUNCTION} at ${LEVEL} calls ${TARGET}")
+            math(EXPR FAILED "${FAILED} + 1")
+        endif()
+    endforeach()
+endforeach()
+
+if(CHECKED EQUAL 0)
+    message(FATAL_ERROR "check_inlining: no iris_call_* functions found in ${SOURCE}")
+endif()
+if(FAILED GREATER 0)
+    message(FATAL_ERROR "check_inlining: ${FAILED} calls left in the iris_call_* functions")
+endif()
+message("check_inlining: ${CHECKED} callers inline their kernels")
@@ -0,0 +1,60 @@
+# Compiles hot_loops.cpp at -O2 and fails unless every backend::scalar
+# instantiation in it (and the scalar templates they call) is vectorized.
+#
+# cmake -DCXX=<g++> -DINCLUDE=<include dir> -DBINARY_DIR=<dir> -P check.cmake
+
+set(SOURCE ${CMAKE_CURRENT_LIST_DIR}/hot_loops.cpp)
+set(DUMP ${BINARY_DIR}/hot_loops.vect)
+
+execute_process(
+    COMMAND ${CXX} -std=c++1z -O2 -DIRIS_ARM_NEON=1 -I${INCLUDE}
+            -c ${SOURCE} -o ${BINARY_DIR}/hot_loops.o
+            -fdump-tree-vect-optimized-missed=${DUMP}
+    RESULT_VARIABLE COMPILE_RESULT)
+if(NOT COMPILE_RESULT EQUAL 0)
+    message(FATAL_ERROR "check_vectorization: ${SOURCE} does not compile")
+endif()
+
+# ';' separates CMake list items, so the function headers are renamed first
+file(READ ${DUMP} CONTENT)
+string(REPLACE ";; Function " "@FUNCTION " CONTENT "${CONTENT}")
+string(REPLACE ";" "," CONTENT "${CONTENT}")
+string(REGEX MATCHALL "@FUNCTION [^\n]*|[^\n]*: optimized: [^\n]*|[^\n]*: missed: [^\n]*" LINES "${CONTENT}")
+
+set(CHECKED 0)
+set(FAILED "")
+set(FUNCTION "")
+foreach(LINE IN LISTS LINES ITEMS "@FUNCTION <end>")
+    if(LINE MATCHES "^@FUNCTION ([^(]*) \\(" OR LINE STREQUAL "@FUNCTION <end>")
+        set(NEXT "${CMAKE_MATCH_1}")
+        if(FUNCTION MATCHES "backend::scalar>")
+            math(EXPR CHECKED "${CHECKED} + 1")
+            if(NOT VECTORIZED)
+                list(APPEND FAILED "${FUNCTION}")
+                message("not vectorized: ${FUNCTION}")
+                foreach(NOTE IN LISTS MISSED)
+                    message("    ${NOTE}")
+                endforeach()
+            endif()
+        endif()
+        set(FUNCTION "${NEXT}")
+        set(VECTORIZED FALSE)
+        set(MISSED "")
+    elseif(LINE MATCHES ": optimized: .*vectorized")
+        set(VECTORIZED TRUE)
+    elseif(LINE MATCHES ": missed: " AND NOT LINE MATCHES "misalign|[Nn]aturally aligned")
+        list(LENGTH MISSED MISSED_COUNT)
+        if(MISSED_COUNT LESS 4)
+            list(APPEND MISSED "${LINE}")
+        endif()
+    endif()
+endforeach()
+
+if(CHECKED EQUAL 0)
+    message(FATAL_ERROR "check_vectorization: no scalar templates found in ${DUMP}")
+endif()
+list(LENGTH FAILED FAILED_COUNT)
+if(FAILED_COUNT GREATER 0)
+    message(FATAL_ERROR "check_vectorization: ${FAILED_COUNT} of ${CHECKED} scalar templates are no longer vectorized")
+endif()
+message("check_vectorization: ${CHECKED} scalar templates vectorized")
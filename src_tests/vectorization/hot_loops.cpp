@@ -0,0 +1,45 @@
+// Scalar reference templates that GCC must vectorize at -O2; checked by
+// the check_vectorization target (check.cmake).
+#include <iris/iris.h>
+using namespace iris;
+using namespace iris::arm;
+using backend::scalar;
+
+template int16x8_t addition::__vadd<int16x8_t, scalar>(int16x8_t, int16x8_t);
+template uint8x16_t addition::__vqadd<uint8x16_t, scalar>(uint8x16_t, uint8x16_t);
+template int16x8_t addition::__vqadd<int16x8_t, scalar>(int16x8_t, int16x8_t);
+template int32x4_t addition::__vqadd<int32x4_t, scalar>(int32x4_t, int32x4_t);
+template int32x4_t addition::__vaddl<int16x4_t, int32x4_t, scalar>(int16x4_t, int16x4_t);
+template uint16x8_t addition::__vaddw<uint16x8_t, uint8x8_t, scalar>(uint16x8_t, uint8x8_t);
+template uint8x16_t addition::__vhadd<uint8x16_t, scalar>(uint8x16_t, uint8x16_t);
+template uint8x16_t addition::__vrhadd<uint8x16_t, scalar>(uint8x16_t, uint8x16_t);
+template int8x8_t addition::__vaddhn<int16x8_t, int8x8_t, scalar>(int16x8_t, int16x8_t);
+template float32x4_t substraction::__vsub<float32x4_t, scalar>(float32x4_t, float32x4_t);
+template int8x16_t substraction::__vqsub<int8x16_t, scalar>(int8x16_t, int8x16_t);
+template uint16x8_t substraction::__vqsub<uint16x8_t, scalar>(uint16x8_t, uint16x8_t);
+template int32x4_t substraction::__vqsub<int32x4_t, scalar>(int32x4_t, int32x4_t);
+template int32x4_t substraction::__vsubl<int16x4_t, int32x4_t, scalar>(int16x4_t, int16x4_t);
+template int16x8_t substraction::__vhsub<int16x8_t, scalar>(int16x8_t, int16x8_t);
+template int32x4_t multiplication::__vmul<int32x4_t, scalar>(int32x4_t, int32x4_t);
+template float32x4_t multiplication::__vmul<float32x4_t, scalar>(float32x4_t, float32x4_t);
+template uint16x8_t multiplication::__vmull<uint8x8_t, uint16x8_t, scalar>(uint8x8_t, uint8x8_t);
+template int16x8_t multiplication_addition::__vmla<int16x8_t, scalar>(int16x8_t, int16x8_t, int16x8_t);
+template uint32x4_t multiplication_substraction::__vmls<uint32x4_t, scalar>(uint32x4_t, uint32x4_t, uint32x4_t);
+template uint8x16_t bitwise::__vand<uint8x16_t, scalar>(uint8x16_t, uint8x16_t);
+template int32x4_t bitwise::__veor<int32x4_t, scalar>(int32x4_t, int32x4_t);
+template int16x8_t bitwise::__vbic<int16x8_t, scalar>(int16x8_t, int16x8_t);
+template uint16x8_t comparison::__vceq<int16x8_t, uint16x8_t, scalar>(int16x8_t, int16x8_t);
+template uint16x8_t comparison::__vcgt<int16x8_t, uint16x8_t, scalar>(int16x8_t, int16x8_t);
+template uint8x16_t comparison::__vtst<uint8x16_t, uint8x16_t, scalar>(uint8x16_t, uint8x16_t);
+template uint32x4_t comparison::__vcge<float32x4_t, uint32x4_t, scalar>(float32x4_t, float32x4_t);
+template uint8x16_t values::__vmax<uint8x16_t, scalar>(uint8x16_t, uint8x16_t);
+template int16x8_t values::__vmin<int16x8_t, scalar>(int16x8_t, int16x8_t);
+template int32x4_t values::__vmax<int32x4_t, scalar>(int32x4_t, int32x4_t);
+template float32x4_t values::__vmax<float32x4_t, scalar>(float32x4_t, float32x4_t);
+template int32x4_t values::__vneg<int32x4_t, scalar>(int32x4_t);
+template int8x16_t values::__vqneg<int8x16_t, scalar>(int8x16_t);
+template int16x8_t values::__vqabs<int16x8_t, scalar>(int16x8_t);
+template int32x4_t values::__vqabs<int32x4_t, scalar>(int32x4_t);
+template int16x8_t shift::__vshl_n<int16x8_t, scalar>(int16x8_t, uint32_t);
+template uint32x4_t shift::__vshr_n<uint32x4_t, scalar>(uint32x4_t, uint32_t);
+template int8x16_t shift::__vshr_n<int8x16_t, scalar>(int8x16_t, uint32_t);